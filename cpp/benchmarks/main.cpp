@@ -0,0 +1,9 @@
+#define CATCH_CONFIG_RUNNER
+#include "catch.hpp"
+
+int main(int argc, char* argv[]) {
+    Catch::Session session;
+    // The largest benchmarks build lists of millions of elements, keep the default run reasonably short
+    session.configData().benchmarkSamples = 10;
+    return session.run(argc, argv);
+}
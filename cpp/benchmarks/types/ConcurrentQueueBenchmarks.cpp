@@ -0,0 +1,74 @@
+#include "catch.hpp"
+#include "types/ConcurrentQueue.hpp"
+#include "types/LinkedList.hpp"
+#include "types/Vector.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace {
+    // Baseline the lock-free queue is compared to
+    class LockedQueue {
+        std::mutex mutex;
+        LinkedList<long> list;
+    public:
+        void push(long value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            list.push(value);
+        }
+
+        bool pop(long& value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (list.empty()) return false;
+            value = list[0];
+            list.erase(0);
+            return true;
+        }
+    };
+
+    // Runs as many producers as consumers, moving items values through the queue
+    template <typename Queue>
+    long transfer(Queue& queue, size_t threadCount, long items) {
+        std::atomic<long> consumed{0};
+        std::atomic<long> sum{0};
+        Vector<std::thread> threads;
+        for (size_t t = 0; t < threadCount; t++) {
+            threads.push(std::thread([&queue, threadCount, items, t]() {
+                for (long i = (long)t; i < items; i += (long)threadCount) queue.push(i);
+            }));
+            threads.push(std::thread([&queue, &consumed, &sum, items]() {
+                long value;
+                long local = 0;
+                while (consumed.load(std::memory_order_relaxed) < items) {
+                    if (queue.pop(value)) {
+                        local += value;
+                        consumed.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                sum += local;
+            }));
+        }
+        for (auto& thread: threads) thread.join();
+        return sum.load();
+    }
+}
+
+TEST_CASE("ConcurrentQueue throughput", "[benchmark]") {
+    const long items = 200000;
+    size_t cores = std::thread::hardware_concurrency();
+    if (cores == 0) cores = 1;
+
+    for (size_t threadCount = 1; threadCount <= cores; threadCount = threadCount * 2 > cores && threadCount < cores ? cores : threadCount * 2) {
+        BENCHMARK("lock-free " + std::to_string(threadCount) + " producers/consumers") {
+            ConcurrentQueue<long> queue;
+            return transfer(queue, threadCount, items);
+        };
+
+        BENCHMARK("mutex " + std::to_string(threadCount) + " producers/consumers") {
+            LockedQueue queue;
+            return transfer(queue, threadCount, items);
+        };
+    }
+}
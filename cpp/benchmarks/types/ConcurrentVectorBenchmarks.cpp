@@ -0,0 +1,55 @@
+#include "catch.hpp"
+#include "types/ConcurrentVector.hpp"
+#include "types/Vector.hpp"
+
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace {
+    // Baseline the lock-free vector is compared to
+    class LockedVector {
+        std::mutex mutex;
+        Vector<long> vect;
+    public:
+        void push(long value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            vect.push(value);
+        }
+
+        size_t size() const noexcept {
+            return vect.size();
+        }
+    };
+
+    // Splits items pushes among threadCount threads
+    template <typename V>
+    size_t collect(V& vect, size_t threadCount, long items) {
+        Vector<std::thread> threads;
+        for (size_t t = 0; t < threadCount; t++) {
+            threads.push(std::thread([&vect, threadCount, items, t]() {
+                for (long i = (long)t; i < items; i += (long)threadCount) vect.push(i);
+            }));
+        }
+        for (auto& thread: threads) thread.join();
+        return vect.size();
+    }
+}
+
+TEST_CASE("ConcurrentVector throughput", "[benchmark]") {
+    const long items = 1000000;
+    size_t cores = std::thread::hardware_concurrency();
+    if (cores == 0) cores = 1;
+
+    for (size_t threadCount = 1; threadCount <= cores; threadCount = threadCount * 2 > cores && threadCount < cores ? cores : threadCount * 2) {
+        BENCHMARK("lock-free " + std::to_string(threadCount) + " producers") {
+            ConcurrentVector<long> vect;
+            return collect(vect, threadCount, items);
+        };
+
+        BENCHMARK("mutex " + std::to_string(threadCount) + " producers") {
+            LockedVector vect;
+            return collect(vect, threadCount, items);
+        };
+    }
+}
@@ -0,0 +1,87 @@
+#include "catch.hpp"
+#include "types/LinkedList.hpp"
+#include "types/Vector.hpp"
+
+#include <cstdlib>
+#include <string>
+
+TEST_CASE("LinkedList push/copy scaling", "[benchmark]") {
+    for (size_t size = 1000; size <= 10000000; size *= 10) {
+        BENCHMARK("push " + std::to_string(size)) {
+            LinkedList<int> list;
+            for (size_t i = 0; i < size; i++) list.push((int)i);
+            return list.size();
+        };
+
+        LinkedList<int> list;
+        for (size_t i = 0; i < size; i++) list.push((int)i);
+
+        BENCHMARK("copy " + std::to_string(size)) {
+            LinkedList<int> copy(list);
+            return copy.size();
+        };
+    }
+}
+
+TEST_CASE("LinkedList node allocators traversal", "[benchmark]") {
+    const size_t size = 1000000;
+    LinkedList<int> pooled;
+    LinkedList<int, HeapNodeAllocator<LinkedListNode<int>>> heap;
+    // Interleaving with other allocations scatters heap nodes as a long running process would
+    LinkedList<std::string, HeapNodeAllocator<LinkedListNode<std::string>>> noise;
+    for (size_t i = 0; i < size; i++) {
+        pooled.push((int)i);
+        heap.push((int)i);
+        noise.push(std::string(40, 'a'));
+    }
+
+    BENCHMARK("pooled traversal " + std::to_string(size)) {
+        long sum = 0;
+        for (int value: pooled) sum += value;
+        return sum;
+    };
+
+    BENCHMARK("heap traversal " + std::to_string(size)) {
+        long sum = 0;
+        for (int value: heap) sum += value;
+        return sum;
+    };
+
+    BENCHMARK("pooled push/clear " + std::to_string(size)) {
+        LinkedList<int> list;
+        for (size_t i = 0; i < size; i++) list.push((int)i);
+        return list.size();
+    };
+
+    BENCHMARK("heap push/clear " + std::to_string(size)) {
+        LinkedList<int, HeapNodeAllocator<LinkedListNode<int>>> list;
+        for (size_t i = 0; i < size; i++) list.push((int)i);
+        return list.size();
+    };
+}
+
+TEST_CASE("LinkedList indexed loops", "[benchmark]") {
+    for (size_t size = 1000; size <= 1000000; size *= 10) {
+        LinkedList<int> list;
+        for (size_t i = 0; i < size; i++) list.push((int)i);
+
+        BENCHMARK("indexed loop " + std::to_string(size)) {
+            long sum = 0;
+            for (size_t i = 0; i < list.size(); i++) sum += list[i];
+            return sum;
+        };
+    }
+}
+
+TEST_CASE("LinkedList sort", "[benchmark]") {
+    for (size_t size = 1000; size <= 1000000; size *= 10) {
+        LinkedList<int> list;
+        std::srand(1);
+        for (size_t i = 0; i < size; i++) list.push(std::rand());
+
+        BENCHMARK_ADVANCED("sort " + std::to_string(size))(Catch::Benchmark::Chronometer meter) {
+            Vector<LinkedList<int>> copies(meter.runs(), list);
+            meter.measure([&copies](int run) { copies[run].sort(); return copies[run].size(); });
+        };
+    }
+}
@@ -0,0 +1,51 @@
+#include "catch.hpp"
+#include "types/MappedVector.hpp"
+#include "types/Vector.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+TEST_CASE("MappedVector loading", "[benchmark]") {
+    const size_t size = 1000000;
+    std::string directory = std::filesystem::temp_directory_path().string() + "/algorithmic-" + std::to_string(getpid());
+    std::string textPath = directory + "-dataset.txt";
+    std::string mappedPath = directory + "-dataset.vec";
+    std::remove(mappedPath.c_str());
+    {
+        std::ofstream text(textPath);
+        MappedVector<int64_t> mapped(mappedPath);
+        for (size_t i = 0; i < size; i++) {
+            text << i * 7 << '\n';
+            mapped.push((int64_t)(i * 7));
+        }
+    }
+
+    BENCHMARK("parse and push " + std::to_string(size) + " into Vector") {
+        std::ifstream text(textPath);
+        Vector<int64_t> vect;
+        int64_t value;
+        while (text >> value) vect.push(value);
+        return vect.sum();
+    };
+
+    BENCHMARK("open MappedVector of " + std::to_string(size)) {
+        MappedVector<int64_t> mapped(mappedPath, MappedAccess::ReadOnly);
+        int64_t sum = 0;
+        for (int64_t value: mapped) sum += value;
+        return sum;
+    };
+
+    BENCHMARK("open MappedVector of " + std::to_string(size) + ", sequential access hint") {
+        MappedVector<int64_t> mapped(mappedPath, MappedAccess::ReadOnly);
+        mapped.advise(AccessPattern::Sequential);
+        int64_t sum = 0;
+        for (int64_t value: mapped) sum += value;
+        return sum;
+    };
+
+    std::remove(textPath.c_str());
+    std::remove(mappedPath.c_str());
+}
@@ -0,0 +1,70 @@
+#include "catch.hpp"
+#include "types/SegmentedVector.hpp"
+#include "types/Vector.hpp"
+
+#include <chrono>
+#include <deque>
+#include <string>
+
+namespace {
+    // Longest single push while filling container with size elements
+    template <typename C>
+    double worstPushMicroseconds(size_t size) {
+        C container;
+        double worst = 0;
+        for (size_t i = 0; i < size; i++) {
+            auto begin = std::chrono::steady_clock::now();
+            container.push((int)i);
+            std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - begin;
+            if (elapsed.count() > worst) worst = elapsed.count();
+        }
+        return worst;
+    }
+}
+
+TEST_CASE("SegmentedVector pushes", "[benchmark]") {
+    const size_t size = 50000000;
+
+    BENCHMARK("Vector push " + std::to_string(size)) {
+        Vector<int> vect;
+        for (size_t i = 0; i < size; i++) vect.push((int)i);
+        return vect.size();
+    };
+
+    BENCHMARK("SegmentedVector push " + std::to_string(size)) {
+        SegmentedVector<int> vect;
+        for (size_t i = 0; i < size; i++) vect.push((int)i);
+        return vect.size();
+    };
+
+    BENCHMARK("std::deque push_back " + std::to_string(size)) {
+        std::deque<int> deque;
+        for (size_t i = 0; i < size; i++) deque.push_back((int)i);
+        return deque.size();
+    };
+
+    WARN("worst Vector push: " << worstPushMicroseconds<Vector<int>>(size) << " us");
+    WARN("worst SegmentedVector push: " << worstPushMicroseconds<SegmentedVector<int>>(size) << " us");
+}
+
+TEST_CASE("SegmentedVector reads", "[benchmark]") {
+    const size_t size = 10000000;
+    Vector<int> vect;
+    SegmentedVector<int> segmented;
+    for (size_t i = 0; i < size; i++) {
+        vect.push((int)i);
+        segmented.push((int)i);
+    }
+
+    BENCHMARK("Vector indexed sum " + std::to_string(size)) {
+        long sum = 0;
+        for (size_t i = 0; i < size; i++) sum += vect[i];
+        return sum;
+    };
+
+    BENCHMARK("SegmentedVector indexed sum " + std::to_string(size)) {
+        long sum = 0;
+        for (size_t i = 0; i < size; i++) sum += segmented[i];
+        return sum;
+    };
+}
@@ -0,0 +1,59 @@
+#include "catch.hpp"
+#include "types/Checksum.hpp"
+#include "types/Serialization.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+TEST_CASE("Serialization checkpoints", "[benchmark]") {
+    const size_t size = 4000000;
+    std::string prefix = std::filesystem::temp_directory_path().string() + "/algorithmic-" + std::to_string(getpid());
+    std::string textPath = prefix + "-checkpoint.txt";
+    std::string binaryPath = prefix + "-checkpoint.bin";
+    Vector<int64_t> values;
+    for (size_t i = 0; i < size; i++) values.push((int64_t)(i * 2654435761u));
+
+    BENCHMARK("text dump of " + std::to_string(size)) {
+        std::ofstream text(textPath);
+        for (int64_t value: values) text << value << '\n';
+        return values.size();
+    };
+
+    BENCHMARK("text restore of " + std::to_string(size)) {
+        std::ifstream text(textPath);
+        Vector<int64_t> read;
+        int64_t value;
+        while (text >> value) read.push(value);
+        return read.size();
+    };
+
+    BENCHMARK("serialize " + std::to_string(size)) {
+        serialize(values, binaryPath);
+        return values.size();
+    };
+
+    BENCHMARK("deserialize " + std::to_string(size)) {
+        Vector<int64_t> read;
+        deserialize(binaryPath, read);
+        return read.size();
+    };
+
+    BENCHMARK("verified view of " + std::to_string(size)) {
+        SerializedView<Vector<int64_t>> view(binaryPath);
+        return view[size / 2];
+    };
+
+    BENCHMARK("CRC-32C of " + std::to_string(size * sizeof(int64_t)) + " bytes") {
+        return crc32c(values.begin(), size * sizeof(int64_t));
+    };
+
+    BENCHMARK("software CRC-32C of " + std::to_string(size * sizeof(int64_t)) + " bytes") {
+        return crc32cSoftware(values.begin(), size * sizeof(int64_t));
+    };
+
+    std::remove(textPath.c_str());
+    std::remove(binaryPath.c_str());
+}
@@ -0,0 +1,62 @@
+#include "catch.hpp"
+#include "types/SoAVector.hpp"
+#include "types/Vector.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+namespace {
+    // 64 bytes, of which the scans below read 16
+    struct Record {
+        int64_t id;
+        double price;
+        double quantity;
+        double discount;
+        double tax;
+        int64_t customer;
+        int64_t product;
+        int64_t timestamp;
+    };
+
+    typedef SoAVector<int64_t, double, double, double, double, int64_t, int64_t, int64_t> Records;
+}
+
+TEST_CASE("SoAVector scans", "[benchmark]") {
+    const size_t size = 4000000;
+    Vector<Record> structs;
+    Records columns;
+    for (size_t i = 0; i < size; i++) {
+        int64_t id = (int64_t)i;
+        double price = (double)(i % 1000);
+        double quantity = (double)(i % 7);
+        structs.push({id, price, quantity, 0.1, 0.2, id % 5000, id % 300, id * 3});
+        columns.push(id, price, quantity, 0.1, 0.2, id % 5000, id % 300, id * 3);
+    }
+
+    BENCHMARK("Vector<Record> total " + std::to_string(size)) {
+        double total = 0;
+        for (const Record& record: structs) total += record.price * record.quantity;
+        return total;
+    };
+
+    BENCHMARK("SoAVector total " + std::to_string(size)) {
+        const double* prices = columns.data<1>();
+        const double* quantities = columns.data<2>();
+        double total = 0;
+        for (size_t i = 0; i < columns.size(); i++) total += prices[i] * quantities[i];
+        return total;
+    };
+
+    BENCHMARK("Vector<Record> sort by price " + std::to_string(size)) {
+        Vector<Record> copy(structs);
+        std::sort(copy.begin(), copy.end(), [](const Record& a, const Record& b) { return a.price < b.price; });
+        return copy[0].id;
+    };
+
+    BENCHMARK("SoAVector sortBy price " + std::to_string(size)) {
+        Records copy(columns);
+        copy.sortBy<1>();
+        return std::get<0>(copy[0]);
+    };
+}
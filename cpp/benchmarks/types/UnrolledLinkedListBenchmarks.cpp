@@ -0,0 +1,45 @@
+#include "catch.hpp"
+#include "types/LinkedList.hpp"
+#include "types/UnrolledLinkedList.hpp"
+
+#include <string>
+
+TEST_CASE("UnrolledLinkedList traversal", "[benchmark]") {
+    const size_t size = 1000000;
+    LinkedList<int> list;
+    UnrolledLinkedList<int> unrolled;
+    for (size_t i = 0; i < size; i++) {
+        list.push((int)i);
+        unrolled.push((int)i);
+    }
+
+    BENCHMARK("LinkedList traversal " + std::to_string(size)) {
+        long sum = 0;
+        for (int value: list) sum += value;
+        return sum;
+    };
+
+    BENCHMARK("UnrolledLinkedList traversal " + std::to_string(size)) {
+        long sum = 0;
+        for (int value: unrolled) sum += value;
+        return sum;
+    };
+}
+
+TEST_CASE("UnrolledLinkedList middle insertions", "[benchmark]") {
+    const size_t size = 10000;
+
+    BENCHMARK("LinkedList middle insertions " + std::to_string(size)) {
+        LinkedList<int> list;
+        list.push(0);
+        for (size_t i = 1; i < size; i++) list.insertBefore(list.size() / 2, (int)i);
+        return list.size();
+    };
+
+    BENCHMARK("UnrolledLinkedList middle insertions " + std::to_string(size)) {
+        UnrolledLinkedList<int> list;
+        list.push(0);
+        for (size_t i = 1; i < size; i++) list.insertBefore(list.size() / 2, (int)i);
+        return list.size();
+    };
+}
@@ -0,0 +1,166 @@
+#include "catch.hpp"
+#include "types/Vector.hpp"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+TEST_CASE("Vector bulk operations", "[benchmark]") {
+    const size_t size = 1000000;
+    Vector<int> vect;
+    for (size_t i = 0; i < size; i++) vect.push((int)i);
+    Vector<int> same(vect);
+
+    BENCHMARK("copy " + std::to_string(size)) {
+        Vector<int> copy(vect);
+        return copy.size();
+    };
+
+    BENCHMARK("compare " + std::to_string(size)) {
+        return vect == same;
+    };
+
+    BENCHMARK("fill " + std::to_string(size)) {
+        same.fill(0);
+        return same.size();
+    };
+}
+
+TEST_CASE("Vector arithmetic kernels", "[benchmark]") {
+    const size_t size = 1000000;
+    Vector<float> a, b, c;
+    for (size_t i = 0; i < size; i++) {
+        a.push((float)(i % 100));
+        b.push((float)(i % 7));
+        c.push(0.5f);
+    }
+
+    BENCHMARK("sequential loop sum " + std::to_string(size)) {
+        float sum = 0;
+        for (float value: a) sum += value;
+        return sum;
+    };
+
+    const std::pair<SimdWidth, const char*> widths[] = {
+        {SimdWidth::Scalar, "scalar"}, {SimdWidth::Bits128, "128 bits"}, {SimdWidth::Bits256, "256 bits"}, {SimdWidth::Bits512, "512 bits"}
+    };
+    for (auto& width: widths) {
+        if (width.first > detectedSimdWidth()) continue;
+
+        BENCHMARK(std::string("sum ") + width.second) {
+            return SimdKernels<float>::sum(a.begin(), size, width.first);
+        };
+
+        BENCHMARK(std::string("dot ") + width.second) {
+            return SimdKernels<float>::dot(a.begin(), b.begin(), size, width.first);
+        };
+    }
+
+    BENCHMARK("a + b * c, one pass") {
+        Vector<float> result = a + b * c;
+        return result.size();
+    };
+
+    BENCHMARK("a + b * c, with a temporary") {
+        Vector<float> product(size, 0);
+        for (size_t i = 0; i < size; i++) product[i] = b[i] * c[i];
+        Vector<float> result(size, 0);
+        for (size_t i = 0; i < size; i++) result[i] = a[i] + product[i];
+        return result.size();
+    };
+}
+
+namespace {
+    // Sums elements at pseudo-random positions, nearly every access missing the TLB with regular pages
+    template <typename V>
+    int64_t randomWalk(const V& vect, size_t steps) {
+        uint64_t state = 88172645463325252ull;
+        int64_t sum = 0;
+        for (size_t i = 0; i < steps; i++) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            sum += vect[state % vect.size()];
+        }
+        return sum;
+    }
+
+    template <typename Allocation>
+    void benchmarkAllocation(const std::string& name, size_t size) {
+        Vector<int64_t, DefaultBoundsCheck, Allocation> vect;
+        vect.reserve(size);
+        for (size_t i = 0; i < size; i++) vect.push((int64_t)i);
+
+        BENCHMARK(name + " sequential sum") {
+            return vect.sum();
+        };
+
+        BENCHMARK(name + " random reads") {
+            return randomWalk(vect, 1000000);
+        };
+    }
+}
+
+TEST_CASE("Vector allocation policies", "[benchmark]") {
+    // 256 MB, far more than what the TLB covers with 4 KB pages
+    const size_t size = size_t(32) << 20;
+    benchmarkAllocation<DefaultAllocation>("malloc", size);
+    benchmarkAllocation<AlignedAllocation<64>>("64 bytes aligned", size);
+    benchmarkAllocation<HugePageAllocation>("huge pages", size);
+}
+
+namespace {
+    template <typename Growth>
+    void benchmarkGrowth(const std::string& name, size_t size) {
+        BENCHMARK(name + " push " + std::to_string(size)) {
+            Vector<int, DefaultBoundsCheck, DefaultAllocation, Growth> vect;
+            for (size_t i = 0; i < size; i++) vect.push((int)i);
+            return vect.capacity();
+        };
+    }
+}
+
+TEST_CASE("Vector growth policies", "[benchmark]") {
+    const size_t size = 10000000;
+    benchmarkGrowth<DoublingGrowth>("doubling", size);
+    benchmarkGrowth<OneAndHalfGrowth>("one and a half", size);
+    benchmarkGrowth<PageRoundedGrowth<>>("page rounded", size);
+    benchmarkGrowth<ChunkedGrowth<(size_t(4) << 20)>>("4 MB chunks", size);
+}
+
+TEST_CASE("Vector range insertions", "[benchmark]") {
+    const size_t size = 100000;
+    const size_t inserted = 1000;
+    Vector<int> base, values;
+    for (size_t i = 0; i < size; i++) base.push((int)i);
+    for (size_t i = 0; i < inserted; i++) values.push(-(int)i);
+
+    BENCHMARK("insert " + std::to_string(inserted) + " one by one") {
+        Vector<int> vect(base);
+        for (size_t i = 0; i < inserted; i++) vect.insert(size / 2 + i, values[i]);
+        return vect.size();
+    };
+
+    BENCHMARK("insert " + std::to_string(inserted) + " as a range") {
+        Vector<int> vect(base);
+        vect.insert(size / 2, values.begin(), values.end());
+        return vect.size();
+    };
+
+    Vector<std::string> strings;
+    for (size_t i = 0; i < size; i++) strings.push(std::to_string(i));
+    Vector<std::string> stringValues;
+    for (size_t i = 0; i < inserted; i++) stringValues.push(std::to_string(i));
+
+    BENCHMARK("insert " + std::to_string(inserted) + " strings one by one") {
+        Vector<std::string> vect(strings);
+        for (size_t i = 0; i < inserted; i++) vect.insert(size / 2 + i, stringValues[i]);
+        return vect.size();
+    };
+
+    BENCHMARK("insert " + std::to_string(inserted) + " strings as a range") {
+        Vector<std::string> vect(strings);
+        vect.insert(size / 2, stringValues.begin(), stringValues.end());
+        return vect.size();
+    };
+}
@@ -0,0 +1,186 @@
+#ifndef ALLOCATION_HPP
+#define ALLOCATION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+/*
+ * Allocation policies of Vector, deciding where its elements live. A policy provides:
+ *  - static constexpr size_t alignment: alignment of every block it returns
+ *  - static void* allocate(size_t bytes): throws std::bad_alloc on failure
+ *  - static void* reallocate(void* memory, size_t bytes, size_t newBytes): resizes a block, possibly moving it as
+ *    raw bytes (only used for trivially copyable elements)
+ *  - static void deallocate(void* memory, size_t bytes) noexcept
+ */
+
+// malloc/realloc/free
+struct DefaultAllocation {
+    static constexpr size_t alignment = alignof(std::max_align_t);
+
+    static void* allocate(size_t bytes) {
+        void* memory = std::malloc(bytes);
+        if (memory == nullptr) throw std::bad_alloc();
+        return memory;
+    }
+
+    static void* reallocate(void* memory, size_t, size_t newBytes) {
+        void* newMemory = std::realloc(memory, newBytes);
+        if (newMemory == nullptr) throw std::bad_alloc();
+        return newMemory;
+    }
+
+    static void deallocate(void* memory, size_t) noexcept {
+        std::free(memory);
+    }
+};
+
+// Blocks aligned on Alignment bytes, by default a cache line so that vector loads never straddle two of them
+template <size_t Alignment = 64>
+struct AlignedAllocation {
+    static_assert(Alignment >= alignof(void*) && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two multiple of the pointer size");
+
+    static constexpr size_t alignment = Alignment;
+
+    static void* allocate(size_t bytes) {
+        // aligned_alloc wants a multiple of the alignment
+        void* memory = std::aligned_alloc(Alignment, (bytes + Alignment - 1) / Alignment * Alignment);
+        if (memory == nullptr) throw std::bad_alloc();
+        return memory;
+    }
+
+    // There is no aligned realloc
+    static void* reallocate(void* memory, size_t bytes, size_t newBytes) {
+        void* newMemory = allocate(newBytes);
+        if (memory != nullptr) {
+            std::memcpy(newMemory, memory, bytes < newBytes ? bytes : newBytes);
+            std::free(memory);
+        }
+        return newMemory;
+    }
+
+    static void deallocate(void* memory, size_t) noexcept {
+        std::free(memory);
+    }
+};
+
+/*
+ * Backs blocks of at least HugePageSize bytes with 2 MB pages, each one covering what 512 regular pages do, which
+ * cuts TLB misses when scanning very large vectors. Smaller blocks come from AlignedAllocation<64>.
+ * By default the pages are transparent huge pages (madvise(MADV_HUGEPAGE), honoured unless THP are disabled system
+ * wide). Reserved uses the huge pages reserved through /proc/sys/vm/nr_hugepages (MAP_HUGETLB) instead, falling back
+ * to transparent ones when none are left. Large blocks grow through mremap, without copying.
+ * Outside of Linux this is AlignedAllocation<64>.
+ */
+template <bool Reserved = false>
+struct BasicHugePageAllocation {
+    static constexpr size_t alignment = 64;
+    static constexpr size_t HugePageSize = size_t(2) << 20;
+
+#if defined(__linux__)
+private:
+    typedef AlignedAllocation<alignment> Small;
+
+    static size_t rounded(size_t bytes) noexcept {
+        return (bytes + HugePageSize - 1) / HugePageSize * HugePageSize;
+    }
+
+    static bool isLarge(size_t bytes) noexcept {
+        return bytes >= HugePageSize;
+    }
+
+    // Transparent huge pages only back 2 MB aligned ranges: maps 2 MB more than needed, then unmaps the unaligned
+    // head and the tail
+    static void* mapAligned(size_t bytes) {
+        size_t mappedBytes = rounded(bytes) + HugePageSize;
+        void* mapping = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED) throw std::bad_alloc();
+        uintptr_t start = reinterpret_cast<uintptr_t>(mapping);
+        uintptr_t aligned = (start + HugePageSize - 1) / HugePageSize * HugePageSize;
+        size_t head = aligned - start;
+        if (head > 0) munmap(mapping, head);
+        munmap(reinterpret_cast<void*>(aligned + rounded(bytes)), HugePageSize - head);
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    static void* map(size_t bytes) {
+        void* memory = MAP_FAILED;
+        if constexpr (Reserved) {
+            // Always aligned on the huge page size
+            memory = mmap(nullptr, rounded(bytes), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        }
+        if (memory == MAP_FAILED) {
+            memory = mapAligned(bytes);
+            madvise(memory, rounded(bytes), MADV_HUGEPAGE);
+        }
+        return memory;
+    }
+
+    // Grows in place when the following addresses are free, otherwise moves the pages to a new aligned range
+    static void* remap(void* memory, size_t bytes, size_t newBytes) {
+        void* newMemory = mremap(memory, rounded(bytes), rounded(newBytes), 0);
+        if (newMemory == MAP_FAILED) {
+            void* target = mapAligned(newBytes);
+            newMemory = mremap(memory, rounded(bytes), rounded(newBytes), MREMAP_MAYMOVE | MREMAP_FIXED, target);
+            if (newMemory == MAP_FAILED) {
+                munmap(target, rounded(newBytes));
+                throw std::bad_alloc();
+            }
+        }
+        return newMemory;
+    }
+public:
+    static void* allocate(size_t bytes) {
+        return isLarge(bytes) ? map(bytes) : Small::allocate(bytes);
+    }
+
+    static void* reallocate(void* memory, size_t bytes, size_t newBytes) {
+        if (memory == nullptr) return allocate(newBytes);
+        if (isLarge(bytes) && isLarge(newBytes)) {
+            if (rounded(bytes) == rounded(newBytes)) return memory;
+            // Reserved huge pages can be remapped as well, as long as the sizes are multiples of their size
+            void* newMemory = remap(memory, bytes, newBytes);
+            madvise(newMemory, rounded(newBytes), MADV_HUGEPAGE);
+            return newMemory;
+        }
+        if (!isLarge(bytes) && !isLarge(newBytes)) return Small::reallocate(memory, bytes, newBytes);
+
+        void* newMemory = allocate(newBytes);
+        std::memcpy(newMemory, memory, bytes < newBytes ? bytes : newBytes);
+        deallocate(memory, bytes);
+        return newMemory;
+    }
+
+    static void deallocate(void* memory, size_t bytes) noexcept {
+        if (memory == nullptr) return;
+        if (isLarge(bytes)) {
+            munmap(memory, rounded(bytes));
+        } else {
+            Small::deallocate(memory, bytes);
+        }
+    }
+#else
+    static void* allocate(size_t bytes) {
+        return AlignedAllocation<alignment>::allocate(bytes);
+    }
+
+    static void* reallocate(void* memory, size_t bytes, size_t newBytes) {
+        return AlignedAllocation<alignment>::reallocate(memory, bytes, newBytes);
+    }
+
+    static void deallocate(void* memory, size_t bytes) noexcept {
+        AlignedAllocation<alignment>::deallocate(memory, bytes);
+    }
+#endif
+};
+
+typedef BasicHugePageAllocation<false> HugePageAllocation;
+typedef BasicHugePageAllocation<true> ReservedHugePageAllocation;
+
+#endif
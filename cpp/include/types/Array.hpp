@@ -1,92 +1,149 @@
 #ifndef ARRAY_HPP
 #define ARRAY_HPP
 
-#include "types/Exceptions.hpp"
+#include "types/BoundsCheck.hpp"
+#include "types/BulkOperations.hpp"
+#include "types/Expressions.hpp"
+#include "types/SimdKernels.hpp"
 
 #include <cstdlib>
+#include <utility>
 
-template <typename T, size_t S>
+template <typename T, size_t S, typename BoundsCheck = DefaultBoundsCheck>
 class Array {
-    T items[S];
+    // Value initialized first, as constant expressions cannot leave any element uninitialized
+    T items[S]{};
 public:
-    Array(const T& value = {}) noexcept { 
+    constexpr Array(const T& value = {}) noexcept { 
         fill(value); 
     }
 
-    Array(Array<T, S>& other) noexcept { 
-        for(size_t i = 0; i < size(); i++) items[i] = other[i];
-    }
+    // Defaulted, so that an Array of trivially copyable elements is itself trivially copyable and copied as a block.
+    // Being defaulted, they are constexpr whenever T allows it.
+    Array(const Array&) = default;
 
-    Array(const Array<T, S>& other) noexcept { 
-        for(size_t i = 0; i < size(); i++) items[i] = other[i];
-    }
+    Array& operator=(const Array&) = default;
 
-    Array<T, S>& operator=(Array<T, S>& other) {
-        for(size_t i = 0; i < size(); i++) items[i] = other[i];
-        return *this;
+    // Computes an element-wise expression of arithmetic Arrays in a single pass, see Expressions.hpp
+    template <typename E, typename = std::enable_if_t<IsExpression<E>::value>>
+    Array(const E& expression) {
+        (*this) = expression;
     }
 
-    Array<T, S>& operator=(const Array<T, S>& other) {
-        for(size_t i = 0; i < size(); i++) items[i] = other[i];
+    // Throws IllegalAccessException if the expression does not have S elements, it may read this very array
+    template <typename E, typename = std::enable_if_t<IsExpression<E>::value>>
+    Array& operator=(const E& expression) {
+        if (expression.size() != S) throw IllegalAccessException();
+        SimdKernels<T>::evaluate(items, expression, S);
         return *this;
     }
 
-    const T& operator[](size_t i) const { 
-        if (i >= size()) throw IllegalIndexException(i);
+    constexpr const T& operator[](size_t i) const { 
+        BoundsCheck::check(i, size());
         return items[i]; 
     }
 
-    T& operator[](size_t i) { 
-        if (i >= size()) throw IllegalIndexException(i);
+    constexpr T& operator[](size_t i) { 
+        BoundsCheck::check(i, size());
+        return items[i];
+    }
+
+    constexpr const T& at(size_t i) const {
+        CheckedBounds::check(i, size());
+        return items[i];
+    }
+
+    constexpr T& at(size_t i) {
+        CheckedBounds::check(i, size());
         return items[i];
     }
 
-    bool operator==(const Array& other) const noexcept {
-        for(size_t i = 0; i < size(); i++) {
-            if(items[i] != other.items[i]) return false;
-        }
-        return true;
+    constexpr bool operator==(const Array& other) const noexcept {
+        return equalElements(items, other.items, S);
     }
 
-    bool operator!=(const Array& other) const noexcept {
+    constexpr bool operator!=(const Array& other) const noexcept {
         return !((*this) == other);
     }
 
+    // Builds the array whose element i is f(i), e.g. a lookup table computed at compile time:
+    //   constexpr auto squares = Array<int, 16>::generate([](size_t i) { return int(i * i); });
+    template <typename F>
+    static constexpr Array generate(F f) {
+        Array result;
+        for (size_t i = 0; i < S; i++) result.items[i] = f(i);
+        return result;
+    }
+
     inline constexpr size_t size() const noexcept { 
         return S; 
     }
 
-    void fill(const T& value) noexcept { 
-        for(size_t i = 0; i < size(); i++) items[i] = value;
+    constexpr void fill(const T& value) noexcept { 
+        fillElements(items, S, value);
     }
 
-    void swap(size_t a, size_t b) {
-        if (a >= size() || b >= size()) throw IllegalIndexException(a > b ? a : b);
+    constexpr void swap(size_t a, size_t b) {
+        if (a >= size() || b >= size()) throwIllegalIndex(a > b ? a : b);
 
         T tmp = std::move(items[a]);
         items[a] = std::move(items[b]);
         items[b] = std::move(tmp);
     }
 
-    T& first() noexcept {
+    constexpr T& first() noexcept {
         return items[0];
     }
 
-    T& last() noexcept {
+    constexpr T& last() noexcept {
         return items[size() - 1];
     }
 
-    const T& first() const noexcept {
+    constexpr const T& first() const noexcept {
         return items[0];
     }
 
-    const T& last() const noexcept {
+    constexpr const T& last() const noexcept {
         return items[size() - 1];
     }
 
     typedef T* iterator; 
     typedef const T* const_iterator;
 
+    // Vectorized kernels, for arithmetic elements only (see SimdKernels.hpp)
+    T sum() const {
+        return SimdKernels<T>::sum(items, S);
+    }
+
+    T min() const {
+        static_assert(S > 0, "min of an empty Array");
+        return SimdKernels<T>::min(items, S);
+    }
+
+    T max() const {
+        static_assert(S > 0, "max of an empty Array");
+        return SimdKernels<T>::max(items, S);
+    }
+
+    T dot(const Array& other) const {
+        return SimdKernels<T>::dot(items, other.items, S);
+    }
+
+    // Adds alpha * x[i] to every element i
+    void axpy(const T& alpha, const Array& x) {
+        SimdKernels<T>::axpy(alpha, x.items, items, S);
+    }
+
+    // First element equal to value, end() if there is none
+    iterator find(const T& value) const {
+        return begin() + SimdKernels<T>::find(items, S, value);
+    }
+
+    // Number of elements equal to value
+    size_t occurrences(const T& value) const {
+        return SimdKernels<T>::count(items, S, value);
+    }
+
     constexpr iterator begin() noexcept { 
         return iterator(items); 
     }
@@ -120,4 +177,9 @@ public:
     }    
 };
 
+template <typename T, size_t S, typename BoundsCheck>
+struct ExpressionContainer<Array<T, S, BoundsCheck>> : std::is_arithmetic<T> {
+    typedef T value_type;
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef BOUNDS_CHECK_HPP
+#define BOUNDS_CHECK_HPP
+
+#include "types/Exceptions.hpp"
+
+#include <cassert>
+#include <cstdlib>
+
+#if defined(__GNUC__)
+#define ALGORITHMIC_COLD __attribute__((noinline, cold))
+#else
+#define ALGORITHMIC_COLD
+#endif
+
+// Kept out of line so that building the exception message never bloats the inlined accessors
+[[noreturn]] ALGORITHMIC_COLD inline void throwIllegalIndex(size_t index) {
+    throw IllegalIndexException(index);
+}
+
+// Throws IllegalIndexException for any index outside of [0, size)
+struct CheckedBounds {
+    static constexpr void check(size_t index, size_t size) {
+        if (index >= size) throwIllegalIndex(index);
+    }
+};
+
+// Only validates indexes through assert(), i.e. in builds where NDEBUG is not defined
+struct AssertedBounds {
+    static constexpr void check(size_t index, size_t size) noexcept {
+        assert(index < size);
+        (void)index;
+        (void)size;
+    }
+};
+
+// No validation at all, an out of range index is undefined behaviour
+struct UncheckedBounds {
+    static constexpr void check(size_t, size_t) noexcept {}
+};
+
+// Build-wide default, selected by defining ALGORITHMIC_UNCHECKED_BOUNDS or ALGORITHMIC_ASSERTED_BOUNDS
+#if defined(ALGORITHMIC_UNCHECKED_BOUNDS)
+typedef UncheckedBounds DefaultBoundsCheck;
+#elif defined(ALGORITHMIC_ASSERTED_BOUNDS)
+typedef AssertedBounds DefaultBoundsCheck;
+#else
+typedef CheckedBounds DefaultBoundsCheck;
+#endif
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef BULK_OPERATIONS_HPP
+#define BULK_OPERATIONS_HPP
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+/*
+ * Operations over ranges of elements, dispatched on type traits: the raw memory functions whenever the bytes of
+ * the elements say it all, element by element otherwise. Constant expressions always take the element-wise path.
+ */
+
+constexpr bool isConstantEvaluated() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+// Assigns source[0, count) to the (constructed) elements destination[0, count), the ranges may overlap
+template <typename T>
+constexpr void copyElements(T* destination, const T* source, size_t count) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if (!isConstantEvaluated()) {
+            if (count > 0) std::memmove(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+            return;
+        }
+    }
+    for (size_t i = 0; i < count; i++) destination[i] = source[i];
+}
+
+// Copy constructs source[0, count) into the uninitialized, non overlapping, storage at destination
+template <typename T>
+void copyConstructElements(T* destination, const T* source, size_t count) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if (count > 0) std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+    } else {
+        std::uninitialized_copy(source, source + count, destination);
+    }
+}
+
+// memsets destination[0, count) to value if all the bytes of value are the same (e.g. zeros or -1), returns
+// whether it did
+template <typename T>
+bool fillUniformBytes(T* destination, size_t count, const T& value) noexcept {
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, static_cast<const void*>(&value), sizeof(T));
+    for (size_t i = 1; i < sizeof(T); i++) {
+        if (bytes[i] != bytes[0]) return false;
+    }
+    if (count > 0) std::memset(static_cast<void*>(destination), bytes[0], count * sizeof(T));
+    return true;
+}
+
+// Assigns value to the (constructed) elements destination[0, count)
+template <typename T>
+constexpr void fillElements(T* destination, size_t count, const T& value) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if (!isConstantEvaluated() && fillUniformBytes(destination, count, value)) return;
+    }
+    for (size_t i = 0; i < count; i++) destination[i] = value;
+}
+
+// Whether a[0, count) and b[0, count) hold the same values. Scalars whose equal values always have the same bytes
+// (integers, enums, pointers, but no float) are compared as raw memory. Classes are left alone even then, their
+// operator!= may not be a bytewise comparison.
+template <typename T>
+constexpr bool equalElements(const T* a, const T* b, size_t count) {
+    if constexpr (std::is_scalar<T>::value && std::has_unique_object_representations<T>::value) {
+        if (!isConstantEvaluated()) {
+            return count == 0 || std::memcmp(static_cast<const void*>(a), static_cast<const void*>(b), count * sizeof(T)) == 0;
+        }
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (a[i] != b[i]) return false;
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef CHECKSUM_HPP
+#define CHECKSUM_HPP
+
+#include "types/Array.hpp"
+#include "types/SimdKernels.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+/*
+ * CRC-32C (Castagnoli), as used by iSCSI, ext4 or Btrfs. x86 CPUs with SSE 4.2 compute it in hardware, 8 bytes
+ * per instruction; elsewhere it is computed 8 bytes at a time from tables built at compile time ("slicing by 8").
+ */
+
+constexpr uint32_t Crc32cPolynomial = 0x82F63B78u;
+
+// crc32cTables[0] is the usual byte at a time table, crc32cTables[k] advances a byte through k more zero bytes
+constexpr Array<Array<uint32_t, 256>, 8> crc32cTables = Array<Array<uint32_t, 256>, 8>::generate([](size_t k) {
+    auto byteTable = Array<uint32_t, 256>::generate([](size_t i) {
+        uint32_t crc = (uint32_t)i;
+        for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (Crc32cPolynomial & (0u - (crc & 1u)));
+        return crc;
+    });
+    Array<uint32_t, 256> table = byteTable;
+    for (size_t level = 0; level < k; level++) {
+        for (size_t i = 0; i < 256; i++) table[i] = (table[i] >> 8) ^ byteTable[table[i] & 0xFF];
+    }
+    return table;
+});
+
+// Checksum of size bytes starting from crc, the checksum of the bytes before them, to compute it piece by piece
+inline uint32_t crc32cSoftware(const void* data, size_t size, uint32_t crc = 0) noexcept {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    crc = ~crc;
+    for (; size >= 8; size -= 8, bytes += 8) {
+        uint64_t word;
+        std::memcpy(&word, bytes, 8);
+        // Little endian order, the least significant byte is the first one
+        word ^= crc;
+        crc = crc32cTables[7][word & 0xFF] ^ crc32cTables[6][(word >> 8) & 0xFF] ^
+              crc32cTables[5][(word >> 16) & 0xFF] ^ crc32cTables[4][(word >> 24) & 0xFF] ^
+              crc32cTables[3][(word >> 32) & 0xFF] ^ crc32cTables[2][(word >> 40) & 0xFF] ^
+              crc32cTables[1][(word >> 48) & 0xFF] ^ crc32cTables[0][word >> 56];
+    }
+    for (; size > 0; size--, bytes++) crc = (crc >> 8) ^ crc32cTables[0][(crc ^ *bytes) & 0xFF];
+    return ~crc;
+}
+
+#if defined(ALGORITHMIC_X86_DISPATCH) && defined(__x86_64__)
+ALGORITHMIC_TARGET("sse4.2") inline uint32_t crc32cHardware(const void* data, size_t size, uint32_t crc = 0) noexcept {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t state = ~crc;
+    for (; size >= 8; size -= 8, bytes += 8) {
+        uint64_t word;
+        std::memcpy(&word, bytes, 8);
+        state = __builtin_ia32_crc32di(state, word);
+    }
+    uint32_t tail = (uint32_t)state;
+    for (; size > 0; size--, bytes++) tail = __builtin_ia32_crc32qi(tail, *bytes);
+    return ~tail;
+}
+#endif
+
+inline uint32_t crc32c(const void* data, size_t size, uint32_t crc = 0) noexcept {
+#if defined(ALGORITHMIC_X86_DISPATCH) && defined(__x86_64__)
+    static const bool hardware = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse4.2");
+    }();
+    if (hardware) return crc32cHardware(data, size, crc);
+#endif
+    return crc32cSoftware(data, size, crc);
+}
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef CONCURRENT_QUEUE_HPP
+#define CONCURRENT_QUEUE_HPP
+
+#include "types/HazardPointers.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// LinkedListNode counterpart whose next pointer can be updated concurrently. The value is constructed and destroyed
+// by the queue itself, since the first node of the queue never holds one.
+template <typename T>
+struct ConcurrentQueueNode {
+    alignas(T) unsigned char storage[sizeof(T)];
+    std::atomic<ConcurrentQueueNode<T>*> next;
+
+    ConcurrentQueueNode() : next(nullptr) {}
+
+    T* value() noexcept { return reinterpret_cast<T*>(storage); }
+};
+
+/*
+ * Unbounded lock-free multi-producer multi-consumer FIFO queue (Michael & Scott, 1996).
+ * The head always points to a dummy node, the values live in the nodes after it. Dequeued nodes are reclaimed
+ * through hazard pointers, so no thread ever reads a node after it has been freed.
+ */
+template <typename T>
+class ConcurrentQueue {
+    static_assert(std::is_nothrow_move_assignable<T>::value, "ConcurrentQueue moves its values out after having unlinked them");
+
+    typedef ConcurrentQueueNode<T> Node;
+
+    // Producers and consumers mostly touch distinct ends, keep them on distinct cache lines
+    alignas(64) std::atomic<Node*> head;
+    alignas(64) std::atomic<Node*> tail;
+
+    void enqueue(Node* node) {
+        while (true) {
+            Node* last = HazardPointers::protect(0, tail);
+            Node* next = last->next.load(std::memory_order_acquire);
+            if (last != tail.load(std::memory_order_acquire)) continue;
+
+            if (next == nullptr) {
+                if (last->next.compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_relaxed)) {
+                    tail.compare_exchange_strong(last, node, std::memory_order_release, std::memory_order_relaxed);
+                    break;
+                }
+            } else {
+                // Another producer linked its node but has not swung the tail yet, help it
+                tail.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+            }
+        }
+        HazardPointers::clear(0);
+    }
+public:
+    ConcurrentQueue() {
+        Node* dummy = new Node();
+        head.store(dummy, std::memory_order_relaxed);
+        tail.store(dummy, std::memory_order_relaxed);
+    }
+
+    ConcurrentQueue(const ConcurrentQueue&) = delete;
+    ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+    // Not thread safe, no other thread may still be using the queue
+    ~ConcurrentQueue() {
+        Node* node = head.load(std::memory_order_relaxed);
+        Node* next = node->next.load(std::memory_order_relaxed);
+        delete node;
+        while (next != nullptr) {
+            node = next;
+            next = node->next.load(std::memory_order_relaxed);
+            std::destroy_at(node->value());
+            delete node;
+        }
+    }
+
+    void push(const T& value) {
+        Node* node = new Node();
+        try {
+            ::new (static_cast<void*>(node->value())) T(value);
+        } catch (...) {
+            delete node;
+            throw;
+        }
+        enqueue(node);
+    }
+
+    void push(T&& value) {
+        Node* node = new Node();
+        try {
+            ::new (static_cast<void*>(node->value())) T(std::move(value));
+        } catch (...) {
+            delete node;
+            throw;
+        }
+        enqueue(node);
+    }
+
+    // Moves the oldest value into value and returns true, or returns false if the queue was empty
+    bool pop(T& value) {
+        while (true) {
+            Node* first = HazardPointers::protect(0, head);
+            Node* last = tail.load(std::memory_order_acquire);
+            Node* next = HazardPointers::protect(1, first->next);
+            if (first != head.load(std::memory_order_acquire)) continue;
+
+            if (next == nullptr) {
+                HazardPointers::clear(0);
+                HazardPointers::clear(1);
+                return false;
+            }
+
+            if (first == last) {
+                tail.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+
+            if (head.compare_exchange_weak(first, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                // next is now the dummy node, and only this thread may take its value
+                value = std::move(*next->value());
+                std::destroy_at(next->value());
+                HazardPointers::clear(0);
+                HazardPointers::clear(1);
+                HazardPointers::retire(first);
+                return true;
+            }
+        }
+    }
+
+    // Only a snapshot, other threads may push or pop right after
+    bool empty() const {
+        Node* first = HazardPointers::protect(0, head);
+        bool result = first->next.load(std::memory_order_acquire) == nullptr;
+        HazardPointers::clear(0);
+        return result;
+    }
+};
+
+#endif
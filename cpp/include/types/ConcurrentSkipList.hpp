@@ -0,0 +1,321 @@
+#ifndef CONCURRENT_SKIP_LIST_HPP
+#define CONCURRENT_SKIP_LIST_HPP
+
+#include "types/EpochReclamation.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+// SkipListNode counterpart whose links can be updated concurrently. The lowest bit of a link marks the entry owning
+// it as removed, which freezes that link. Entries are never modified once inserted.
+template <typename K, typename V>
+struct ConcurrentSkipListNode {
+    const K key;
+    const V value;
+    size_t height;
+    std::atomic<ConcurrentSkipListNode<K, V>*>* next;
+    // The inserter linking its upper levels and the remover: the last one done with the entry unlinks and retires it
+    std::atomic<int> holders;
+
+    ConcurrentSkipListNode(const K& key, const V& value, size_t height, std::atomic<ConcurrentSkipListNode<K, V>*>* next)
+        : key(key), value(value), height(height), next(next), holders(2) {}
+};
+
+/*
+ * Lock-free ordered map (Herlihy & Shavit, The Art of Multiprocessor Programming, 14.4), the concurrent variant of
+ * SkipList. An entry is removed by marking its links top down, the bottom one deciding which thread removed it,
+ * then unlinked by whichever thread walks past it first. The bottom level alone defines which entries are present.
+ *
+ * Every operation pins its thread's epoch, and unlinked entries are retired through epoch based reclamation: they are
+ * freed once every operation that might still be walking over them has finished, whatever the other threads do.
+ */
+template <typename K, typename V>
+class ConcurrentSkipList {
+public:
+    static constexpr size_t MaxHeight = 32;
+private:
+    typedef ConcurrentSkipListNode<K, V> Node;
+    typedef std::atomic<Node*> Link;
+
+    Link heads[MaxHeight];
+    std::atomic<size_t> count;
+
+    static bool isMarked(Node* link) noexcept {
+        return (reinterpret_cast<uintptr_t>(link) & 1) != 0;
+    }
+
+    static Node* marked(Node* link) noexcept {
+        return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(link) | 1);
+    }
+
+    static Node* unmarked(Node* link) noexcept {
+        return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(link) & ~uintptr_t(1));
+    }
+
+    static Node* createNode(const K& key, const V& value, size_t height) {
+        void* memory = ::operator new(sizeof(Node) + height * sizeof(Link));
+        Link* next = reinterpret_cast<Link*>(static_cast<unsigned char*>(memory) + sizeof(Node));
+        for (size_t level = 0; level < height; level++) ::new (static_cast<void*>(next + level)) Link(nullptr);
+        try {
+            return ::new (memory) Node(key, value, height, next);
+        } catch (...) {
+            ::operator delete(memory);
+            throw;
+        }
+    }
+
+    static void destroyNode(Node* node) noexcept {
+        node->~Node();
+        ::operator delete(static_cast<void*>(node));
+    }
+
+    static size_t randomHeight() noexcept {
+        static thread_local uint64_t seed = 0x9E3779B97F4A7C15ull ^ reinterpret_cast<uintptr_t>(&seed);
+        size_t result = 1;
+        while (result < MaxHeight) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            if ((seed & 3) != 0) break;
+            result++;
+        }
+        return result;
+    }
+
+    // Called once by the inserter and once by the remover of an entry. An inserter may still link an upper level
+    // after the remover unlinked the entry, so only the last of the two can be sure no level gets linked anymore.
+    void release(Node* node) {
+        if (node->holders.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        Link* links[MaxHeight];
+        Node* successors[MaxHeight];
+        search(node->key, links, successors);
+        EpochReclamation::retire(node, [](void* retired) { destroyNode(static_cast<Node*>(retired)); });
+    }
+
+    /*
+     * Fills links with, for every level, the links array of the last entry whose key is less than key (heads if there
+     * is none), and successors with the entry following it. Marked entries met on the way are unlinked.
+     * Returns whether successors[0] is an entry for key.
+     */
+    bool search(const K& key, Link* links[MaxHeight], Node* successors[MaxHeight]) const noexcept {
+    retry:
+        Link* current = const_cast<Link*>(heads);
+        for (size_t level = MaxHeight; level-- > 0;) {
+            Node* node = unmarked(current[level].load(std::memory_order_acquire));
+            while (node != nullptr) {
+                Node* next = node->next[level].load(std::memory_order_acquire);
+                if (isMarked(next)) {
+                    // Fails if the predecessor changed, or is being removed itself
+                    Node* expected = node;
+                    if (!current[level].compare_exchange_strong(expected, unmarked(next), std::memory_order_acq_rel, std::memory_order_acquire)) goto retry;
+                    node = unmarked(next);
+                } else if (node->key < key) {
+                    current = node->next;
+                    node = next;
+                } else {
+                    break;
+                }
+            }
+            links[level] = current;
+            successors[level] = node;
+        }
+        return successors[0] != nullptr && !(key < successors[0]->key);
+    }
+
+    // Entry for key, without unlinking anything on the way
+    Node* findNode(const K& key) const noexcept {
+        const Link* current = heads;
+        Node* node = nullptr;
+        for (size_t level = MaxHeight; level-- > 0;) {
+            node = unmarked(current[level].load(std::memory_order_acquire));
+            while (node != nullptr) {
+                Node* next = node->next[level].load(std::memory_order_acquire);
+                if (isMarked(next)) {
+                    node = unmarked(next);
+                } else if (node->key < key) {
+                    current = node->next;
+                    node = next;
+                } else {
+                    break;
+                }
+            }
+        }
+        return node != nullptr && !(key < node->key) ? node : nullptr;
+    }
+
+    // First present entry whose key is not less than key
+    Node* lowerBoundNode(const K& key) const noexcept {
+        Link* links[MaxHeight];
+        Node* successors[MaxHeight];
+        search(key, links, successors);
+        return successors[0];
+    }
+public:
+    typedef ConcurrentSkipListNode<K, V> Entry;
+
+    // Walks the bottom level, skipping entries removed in the meantime. Iterating concurrently with updates may
+    // or may not see the entries inserted or removed since it started.
+    class Iterator {
+    private:
+        const Node* current;
+        const K* to;
+
+        void skipRemoved() noexcept {
+            while (current != nullptr && isMarked(current->next[0].load(std::memory_order_acquire))) {
+                current = unmarked(current->next[0].load(std::memory_order_acquire));
+            }
+            if (current != nullptr && to != nullptr && !(current->key < *to)) current = nullptr;
+        }
+    public:
+        Iterator(const Node* current = nullptr, const K* to = nullptr) : current(current), to(to) {
+            skipRemoved();
+        }
+        bool operator==(const Iterator& other) const noexcept { return current == other.current; }
+        bool operator!=(const Iterator& other) const noexcept { return current != other.current; }
+        const Entry& operator*() const { return *current; }
+        const Entry* operator->() const { return current; }
+        Iterator operator++() {
+            Iterator tmp = *this;
+            if (current != nullptr) {
+                current = unmarked(current->next[0].load(std::memory_order_acquire));
+                skipRemoved();
+            }
+            return tmp;
+        }
+    };
+
+    typedef Iterator iterator;
+
+    // Entries whose keys lie in [from, to), in increasing order. The range pins the epoch of its thread to keep the
+    // entries it may reach alive, and thus delays reclamation for as long as it exists: it must not outlive the loop
+    // going through it, nor leave its thread.
+    class Range {
+        EpochReclamation::Guard guard;
+        K from;
+        K to;
+        const ConcurrentSkipList& list;
+    public:
+        Range(const ConcurrentSkipList& list, const K& from, const K& to) : from(from), to(to), list(list) {}
+        iterator begin() const { return from < to ? iterator(list.lowerBoundNode(from), &to) : end(); }
+        iterator end() const { return iterator(nullptr); }
+    };
+
+    ConcurrentSkipList() : count(0) {
+        for (auto& head: heads) head.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ConcurrentSkipList(const ConcurrentSkipList&) = delete;
+    ConcurrentSkipList& operator=(const ConcurrentSkipList&) = delete;
+
+    // Not thread safe, no other thread may still be using the list. Entries already retired are freed later on.
+    ~ConcurrentSkipList() {
+        Node* node = unmarked(heads[0].load(std::memory_order_relaxed));
+        while (node != nullptr) {
+            Node* next = unmarked(node->next[0].load(std::memory_order_relaxed));
+            destroyNode(node);
+            node = next;
+        }
+    }
+
+    // Only a snapshot, other threads may insert or erase right after
+    size_t size() const noexcept {
+        return count.load(std::memory_order_relaxed);
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    bool contains(const K& key) const {
+        EpochReclamation::Guard guard;
+        return findNode(key) != nullptr;
+    }
+
+    // Copies the value of the entry for key into value and returns true, or returns false if there is none
+    bool find(const K& key, V& value) const {
+        EpochReclamation::Guard guard;
+        Node* node = findNode(key);
+        if (node == nullptr) return false;
+        value = node->value;
+        return true;
+    }
+
+    Range range(const K& from, const K& to) const {
+        return Range(*this, from, to);
+    }
+
+    // Adds an entry for key, returns false if there already was one
+    bool insert(const K& key, const V& value) {
+        EpochReclamation::Guard guard;
+        Link* links[MaxHeight];
+        Node* successors[MaxHeight];
+        Node* node = nullptr;
+        size_t height = 0;
+
+        while (true) {
+            if (search(key, links, successors)) {
+                if (node != nullptr) destroyNode(node);
+                return false;
+            }
+            if (node == nullptr) {
+                height = randomHeight();
+                node = createNode(key, value, height);
+            }
+            for (size_t level = 0; level < height; level++) node->next[level].store(successors[level], std::memory_order_relaxed);
+            // Linking the bottom level inserts the entry, the upper ones only speed searches up
+            Node* expected = successors[0];
+            if (links[0][0].compare_exchange_strong(expected, node, std::memory_order_release, std::memory_order_relaxed)) break;
+        }
+        count.fetch_add(1, std::memory_order_relaxed);
+
+        for (size_t level = 1; level < height; level++) {
+            bool linked = false;
+            while (!linked) {
+                Node* next = node->next[level].load(std::memory_order_acquire);
+                // Stop as soon as the entry is being removed, the remover cannot unlink levels not linked yet
+                if (isMarked(next)) break;
+                if (next != successors[level] && !node->next[level].compare_exchange_strong(next, successors[level], std::memory_order_release, std::memory_order_relaxed)) break;
+                Node* expected = successors[level];
+                linked = links[level][level].compare_exchange_strong(expected, node, std::memory_order_release, std::memory_order_relaxed);
+                if (!linked) search(key, links, successors);
+            }
+            if (!linked) break;
+        }
+
+        // A remover may have marked the entry while its upper levels were being linked, and searched for it before
+        // they were: unlink them on its behalf if it is done already
+        release(node);
+        return true;
+    }
+
+    // Removes the entry for key, returns false if there was none
+    bool erase(const K& key) {
+        EpochReclamation::Guard guard;
+        Link* links[MaxHeight];
+        Node* successors[MaxHeight];
+        if (!search(key, links, successors)) return false;
+        Node* node = successors[0];
+
+        for (size_t level = node->height; level-- > 1;) {
+            Node* next = node->next[level].load(std::memory_order_acquire);
+            while (!isMarked(next)) {
+                node->next[level].compare_exchange_weak(next, marked(next), std::memory_order_acq_rel, std::memory_order_acquire);
+            }
+        }
+
+        Node* next = node->next[0].load(std::memory_order_acquire);
+        while (true) {
+            // Another thread removed it first
+            if (isMarked(next)) return false;
+            if (node->next[0].compare_exchange_weak(next, marked(next), std::memory_order_acq_rel, std::memory_order_acquire)) break;
+        }
+        count.fetch_sub(1, std::memory_order_relaxed);
+
+        release(node);
+        return true;
+    }
+};
+
+#endif
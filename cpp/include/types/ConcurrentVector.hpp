@@ -0,0 +1,270 @@
+#ifndef CONCURRENT_VECTOR_HPP
+#define CONCURRENT_VECTOR_HPP
+
+#include "types/BoundsCheck.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Append only vector which any number of threads can push to concurrently, without locking.
+ * A push reserves its index with a single fetch_add, then constructs its element in place. Elements live in buckets
+ * of FirstBucketSize, 2 * FirstBucketSize, 4 * FirstBucketSize... elements, allocated on first use and never moved,
+ * so references to elements stay valid as the vector grows.
+ * Every slot has a ready flag, set once its element is constructed. size() only counts the prefix of ready slots:
+ * readers can use any element below it, without locking, while later pushes are still in progress. Whichever
+ * thread completes a push moves that prefix forward over every slot ready by then, its own or not.
+ * Elements cannot be removed, only clear() and the destructor, which must not run concurrently with anything else,
+ * destroy them.
+ */
+template <typename T, size_t FirstBucketSize = 64, typename BoundsCheck = DefaultBoundsCheck>
+class ConcurrentVector {
+    static_assert(FirstBucketSize > 0 && (FirstBucketSize & (FirstBucketSize - 1)) == 0, "FirstBucketSize must be a power of two");
+    static_assert(alignof(T) <= alignof(std::max_align_t), "ConcurrentVector storage is only aligned for fundamental types");
+
+    static constexpr size_t FirstShift = []() {
+        size_t shift = 0;
+        while ((size_t(1) << shift) < FirstBucketSize) shift++;
+        return shift;
+    }();
+    static constexpr size_t BucketCount = sizeof(size_t) * 8 - FirstShift;
+
+    struct Location {
+        size_t bucket;
+        size_t offset;
+    };
+
+    // Ready flags first, then the elements
+    static size_t bucketSize(size_t bucket) noexcept {
+        return FirstBucketSize << bucket;
+    }
+
+    static size_t flagsBytes(size_t bucket) noexcept {
+        size_t alignment = alignof(T);
+        return (bucketSize(bucket) + alignment - 1) / alignment * alignment;
+    }
+
+    static Location locate(size_t index) noexcept {
+        size_t shifted = index + FirstBucketSize;
+        size_t bucket = sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(shifted) - FirstShift;
+        return {bucket, shifted - bucketSize(bucket)};
+    }
+
+    std::atomic<unsigned char*> buckets[BucketCount] = {};
+    // Indexes handed out so far, and how many of the first ones hold constructed elements
+    alignas(64) std::atomic<size_t> reserved{0};
+    alignas(64) std::atomic<size_t> published{0};
+
+    // Allocated zeroed, i.e. with every flag down
+    unsigned char* bucket(size_t index) {
+        unsigned char* memory = buckets[index].load(std::memory_order_acquire);
+        if (memory != nullptr) return memory;
+        unsigned char* allocated = static_cast<unsigned char*>(std::calloc(1, flagsBytes(index) + bucketSize(index) * sizeof(T)));
+        if (allocated == nullptr) throw std::bad_alloc();
+        if (buckets[index].compare_exchange_strong(memory, allocated, std::memory_order_acq_rel, std::memory_order_acquire)) return allocated;
+        // Another thread allocated it first
+        std::free(allocated);
+        return memory;
+    }
+
+    std::atomic<bool>* flag(unsigned char* memory, const Location& location) const noexcept {
+        return reinterpret_cast<std::atomic<bool>*>(memory) + location.offset;
+    }
+
+    T* element(unsigned char* memory, const Location& location) const noexcept {
+        return reinterpret_cast<T*>(memory + flagsBytes(location.bucket)) + location.offset;
+    }
+
+    T* element(size_t index) const noexcept {
+        Location location = locate(index);
+        return element(buckets[location.bucket].load(std::memory_order_acquire), location);
+    }
+
+    bool ready(size_t index) const noexcept {
+        Location location = locate(index);
+        unsigned char* memory = buckets[location.bucket].load(std::memory_order_acquire);
+        return memory != nullptr && flag(memory, location)->load();
+    }
+
+    /*
+     * Moves published over the slots that are ready. The flags and published are sequentially consistent, so that
+     * a push setting its flag after the thread of an earlier slot stopped at it always sees that earlier slot ready
+     * or its thread moving published forward.
+     */
+    void publish() noexcept {
+        size_t next = published.load();
+        while (next < reserved.load(std::memory_order_acquire) && ready(next)) {
+            // On failure, next is reloaded with what another thread published
+            if (published.compare_exchange_weak(next, next + 1)) next++;
+        }
+    }
+
+    // Nothing may throw once the index is reserved: the slot would never be ready, stalling every later one. Running
+    // out of memory or a throwing constructor terminates the program instead.
+    template <typename... Args>
+    void construct(size_t index, Args&&... args) noexcept {
+        Location location = locate(index);
+        unsigned char* memory = bucket(location.bucket);
+        ::new (static_cast<void*>(element(memory, location))) T(std::forward<Args>(args)...);
+        flag(memory, location)->store(true);
+    }
+
+    void destroy() noexcept {
+        size_t count = reserved.load(std::memory_order_acquire);
+        for (size_t bucket = 0; bucket < BucketCount; bucket++) {
+            unsigned char* memory = buckets[bucket].load(std::memory_order_relaxed);
+            if (memory == nullptr) continue;
+            size_t first = (bucketSize(bucket) - FirstBucketSize);
+            if (first < count) {
+                size_t last = count - first < bucketSize(bucket) ? count - first : bucketSize(bucket);
+                std::destroy(element(memory, {bucket, 0}), element(memory, {bucket, last}));
+            }
+        }
+    }
+public:
+    ConcurrentVector() noexcept {}
+
+    ConcurrentVector(const ConcurrentVector&) = delete;
+    ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+
+    // Not thread safe, no other thread may still be using the vector
+    ~ConcurrentVector() {
+        destroy();
+        for (auto& memory: buckets) std::free(memory.load(std::memory_order_relaxed));
+    }
+
+    // Thread safe, returns the index of the element
+    template <typename... Args>
+    size_t emplace(Args&&... args) {
+        size_t index = reserved.fetch_add(1, std::memory_order_acq_rel);
+        construct(index, std::forward<Args>(args)...);
+        publish();
+        return index;
+    }
+
+    size_t push(const T& value) {
+        return emplace(value);
+    }
+
+    size_t push(T&& value) {
+        return emplace(std::move(value));
+    }
+
+    // Thread safe, reserves consecutive indexes for the whole range at once, returns the first one
+    template <typename It, typename = std::enable_if_t<!std::is_integral<It>::value>>
+    size_t append(It first, It last) {
+        static_assert(std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>::value, "The size of the range must be known upfront");
+        size_t added = std::distance(first, last);
+        size_t index = reserved.fetch_add(added, std::memory_order_acq_rel);
+        for (size_t i = index; first != last; ++first, ++i) construct(i, *first);
+        publish();
+        return index;
+    }
+
+    // Thread safe, allocates the buckets for capacity elements so that pushes below it never allocate
+    void reserve(size_t capacity) {
+        if (capacity == 0) return;
+        Location location = locate(capacity - 1);
+        for (size_t index = 0; index <= location.bucket; index++) bucket(index);
+    }
+
+    // Number of elements which can be read, some more may be under construction
+    size_t size() const noexcept {
+        return published.load(std::memory_order_acquire);
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    // Thread safe for indexes below size(). Writing to elements read by other threads needs synchronization.
+    T& operator[](size_t index) {
+        BoundsCheck::check(index, size());
+        return *element(index);
+    }
+
+    const T& operator[](size_t index) const {
+        BoundsCheck::check(index, size());
+        return *element(index);
+    }
+
+    T& at(size_t index) {
+        CheckedBounds::check(index, size());
+        return *element(index);
+    }
+
+    const T& at(size_t index) const {
+        CheckedBounds::check(index, size());
+        return *element(index);
+    }
+
+    // Iterates over the elements published when end() was called
+    class Iterator {
+        friend class ConcurrentVector;
+        const ConcurrentVector* container;
+        size_t index;
+
+        Iterator(const ConcurrentVector* container, size_t index) noexcept : container(container), index(index) {}
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        Iterator() noexcept : container(nullptr), index(0) {}
+
+        reference operator*() const noexcept { return *container->element(index); }
+        pointer operator->() const noexcept { return container->element(index); }
+        reference operator[](difference_type offset) const noexcept { return *container->element(index + offset); }
+
+        Iterator& operator++() noexcept { index++; return *this; }
+        Iterator operator++(int) noexcept { Iterator old = *this; index++; return old; }
+        Iterator& operator--() noexcept { index--; return *this; }
+        Iterator operator--(int) noexcept { Iterator old = *this; index--; return old; }
+        Iterator& operator+=(difference_type offset) noexcept { index += offset; return *this; }
+        Iterator& operator-=(difference_type offset) noexcept { index -= offset; return *this; }
+        Iterator operator+(difference_type offset) const noexcept { return Iterator(container, index + offset); }
+        Iterator operator-(difference_type offset) const noexcept { return Iterator(container, index - offset); }
+        difference_type operator-(const Iterator& other) const noexcept { return (difference_type)index - (difference_type)other.index; }
+
+        bool operator==(const Iterator& other) const noexcept { return index == other.index; }
+        bool operator!=(const Iterator& other) const noexcept { return index != other.index; }
+        bool operator<(const Iterator& other) const noexcept { return index < other.index; }
+        bool operator>(const Iterator& other) const noexcept { return index > other.index; }
+        bool operator<=(const Iterator& other) const noexcept { return index <= other.index; }
+        bool operator>=(const Iterator& other) const noexcept { return index >= other.index; }
+    };
+
+    typedef Iterator iterator;
+    typedef Iterator const_iterator;
+
+    const_iterator begin() const noexcept {
+        return Iterator(this, 0);
+    }
+
+    const_iterator end() const noexcept {
+        return Iterator(this, size());
+    }
+
+    // Not thread safe, keeps the buckets
+    void clear() noexcept {
+        destroy();
+        size_t count = reserved.load(std::memory_order_relaxed);
+        for (size_t bucket = 0; bucket < BucketCount; bucket++) {
+            unsigned char* memory = buckets[bucket].load(std::memory_order_relaxed);
+            if (memory != nullptr && bucketSize(bucket) - FirstBucketSize < count) std::memset(memory, 0, bucketSize(bucket));
+        }
+        reserved.store(0, std::memory_order_relaxed);
+        published.store(0, std::memory_order_release);
+    }
+};
+
+#endif
@@ -0,0 +1,310 @@
+#ifndef DOUBLY_LINKED_LIST_HPP
+#define DOUBLY_LINKED_LIST_HPP
+
+#include <cstdlib>
+#include "types/Exceptions.hpp"
+#include "types/NodePool.hpp"
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename T>
+struct DoublyLinkedListNode {
+    T value;
+    DoublyLinkedListNode<T>* previous = nullptr;
+    DoublyLinkedListNode<T>* next = nullptr;
+    DoublyLinkedListNode(const T& value, DoublyLinkedListNode<T>* previous = nullptr, DoublyLinkedListNode<T>* next = nullptr)
+        : value(value), previous(previous), next(next) {}
+    // Constructs the value in place from args
+    template <typename... Args>
+    DoublyLinkedListNode(std::in_place_t, DoublyLinkedListNode<T>* previous, DoublyLinkedListNode<T>* next, Args&&... args)
+        : value(std::forward<Args>(args)...), previous(previous), next(next) {}
+};
+
+// Linked list whose nodes also point to their predecessor, allowing O(1) removals at both ends and through iterators
+template <typename T, typename Allocator = NodePool<DoublyLinkedListNode<T>>>
+class DoublyLinkedList {
+    DoublyLinkedListNode<T>* head;
+    DoublyLinkedListNode<T>* tail;
+    size_t count;
+    Allocator allocator;
+
+    template <typename... Args>
+    DoublyLinkedListNode<T>* createNode(DoublyLinkedListNode<T>* previous, DoublyLinkedListNode<T>* next, Args&&... args) {
+        DoublyLinkedListNode<T>* node = allocator.allocate();
+        try {
+            ::new (static_cast<void*>(node)) DoublyLinkedListNode<T>(std::in_place, previous, next, std::forward<Args>(args)...);
+        } catch (...) {
+            allocator.deallocate(node);
+            throw;
+        }
+        return node;
+    }
+
+    void destroyNode(DoublyLinkedListNode<T>* node) noexcept {
+        node->~DoublyLinkedListNode<T>();
+        allocator.deallocate(node);
+    }
+
+    // Walks from whichever end of the list is the closest
+    DoublyLinkedListNode<T>* getNode(size_t at) const noexcept {
+        if (at >= count) return nullptr;
+        DoublyLinkedListNode<T>* current;
+        if (at < count / 2) {
+            current = head;
+            for (size_t i = 0; i < at; i++) current = current->next;
+        } else {
+            current = tail;
+            for (size_t i = count - 1; i > at; i--) current = current->previous;
+        }
+        return current;
+    }
+
+    // Links a new node constructed from args between previous and next, either of them being nullptr at the ends
+    // of the list
+    template <typename... Args>
+    DoublyLinkedListNode<T>* link(DoublyLinkedListNode<T>* previous, DoublyLinkedListNode<T>* next, Args&&... args) {
+        DoublyLinkedListNode<T>* added = createNode(previous, next, std::forward<Args>(args)...);
+        if (previous == nullptr) head = added; else previous->next = added;
+        if (next == nullptr) tail = added; else next->previous = added;
+        count++;
+        return added;
+    }
+
+    void unlink(DoublyLinkedListNode<T>* node) noexcept {
+        if (node->previous == nullptr) head = node->next; else node->previous->next = node->next;
+        if (node->next == nullptr) tail = node->previous; else node->next->previous = node->previous;
+        destroyNode(node);
+        count--;
+    }
+
+    void clear(DoublyLinkedListNode<T>* node) {
+        if (!allocator.releasesInBulk()) {
+            while (node != nullptr) {
+                DoublyLinkedListNode<T>* next = node->next;
+                destroyNode(node);
+                node = next;
+            }
+        } else if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (; node != nullptr; node = node->next) node->value.~T();
+        }
+        allocator.release();
+    }
+public:
+    class Iterator {
+        friend class DoublyLinkedList;
+    private:
+        DoublyLinkedListNode<T>* current;
+    public:
+        Iterator(DoublyLinkedListNode<T>* current = nullptr) : current(current) {}
+        bool operator==(const Iterator& other) const noexcept { return current == other.current; }
+        bool operator!=(const Iterator& other) const noexcept { return current != other.current; }
+        T& operator*() const { return current->value; }
+        Iterator operator++() {
+            Iterator tmp = Iterator(current);
+            if(current != nullptr) current = current->next;
+            return tmp;
+        }
+        Iterator operator--() {
+            Iterator tmp = Iterator(current);
+            if(current != nullptr) current = current->previous;
+            return tmp;
+        }
+    };
+
+    typedef Iterator iterator;
+    iterator begin() const { return iterator(head); }
+    iterator end() const { return iterator(nullptr); }
+
+    DoublyLinkedList() : head(nullptr), tail(nullptr), count(0) {}
+
+    DoublyLinkedList(DoublyLinkedList& other) : DoublyLinkedList() {
+        for(auto& value: other) push(value);
+    }
+
+    DoublyLinkedList(const DoublyLinkedList& other) : DoublyLinkedList() {
+        for(auto& value: other) push(value);
+    }
+
+    DoublyLinkedList(DoublyLinkedList&& other) noexcept : DoublyLinkedList() {
+        swap(other);
+    }
+
+    ~DoublyLinkedList() {
+        clear();
+    }
+
+    DoublyLinkedList& operator=(DoublyLinkedList& other) {
+        return (*this) = (const DoublyLinkedList&)other;
+    }
+
+    DoublyLinkedList& operator=(const DoublyLinkedList& other) {
+        if (this == &other) return *this;
+        clear();
+        for(auto& value: other) push(value);
+        return *this;
+    }
+
+    DoublyLinkedList& operator=(DoublyLinkedList&& other) noexcept {
+        if (this == &other) return *this;
+        clear();
+        swap(other);
+        return *this;
+    }
+
+    T& operator[](size_t at) {
+        DoublyLinkedListNode<T>* node = getNode(at);
+        if (node == nullptr) throw IllegalIndexException(at);
+        return node->value;
+    }
+
+    const T& operator[](size_t at) const {
+        DoublyLinkedListNode<T>* node = getNode(at);
+        if (node == nullptr) throw IllegalIndexException(at);
+        return node->value;
+    }
+
+    bool operator==(const DoublyLinkedList& other) const noexcept {
+        if (size() != other.size()) return false;
+        iterator it = other.begin();
+        for(const auto& value: *this) {
+            if (value != *it) return false;
+            ++it;
+        }
+        return true;
+    }
+
+    bool operator!=(const DoublyLinkedList& other) const noexcept {
+        return !((*this) == other);
+    }
+
+    bool empty() const noexcept {
+        return count == 0;
+    }
+
+    size_t size() const noexcept {
+        return count;
+    }
+
+    T& first() {
+        if (empty()) throw IllegalAccessException();
+        return head->value;
+    }
+
+    T& last() {
+        if (empty()) throw IllegalAccessException();
+        return tail->value;
+    }
+
+    void push(const T& value) {
+        emplace(value);
+    }
+
+    void push(T&& value) {
+        emplace(std::move(value));
+    }
+
+    void pushFront(const T& value) {
+        emplaceFront(value);
+    }
+
+    void pushFront(T&& value) {
+        emplaceFront(std::move(value));
+    }
+
+    // Appends an element constructed in place from args, returns it
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        return link(tail, nullptr, std::forward<Args>(args)...)->value;
+    }
+
+    template <typename... Args>
+    T& emplaceFront(Args&&... args) {
+        return link(nullptr, head, std::forward<Args>(args)...)->value;
+    }
+
+    void pop() noexcept {
+        if (!empty()) unlink(tail);
+    }
+
+    void popFront() noexcept {
+        if (!empty()) unlink(head);
+    }
+
+    void insertBefore(size_t at, const T& value) {
+        emplaceBefore(at, value);
+    }
+
+    void insertBefore(size_t at, T&& value) {
+        emplaceBefore(at, std::move(value));
+    }
+
+    void insertAfter(size_t at, const T& value) {
+        emplaceAfter(at, value);
+    }
+
+    void insertAfter(size_t at, T&& value) {
+        emplaceAfter(at, std::move(value));
+    }
+
+    // Inserts an element constructed in place from args before index at, which may be size() to append, returns it
+    template <typename... Args>
+    T& emplaceBefore(size_t at, Args&&... args) {
+        if (at == count) return emplace(std::forward<Args>(args)...);
+        DoublyLinkedListNode<T>* node = getNode(at);
+        if (node == nullptr) throw IllegalIndexException(at);
+        return link(node->previous, node, std::forward<Args>(args)...)->value;
+    }
+
+    // Inserts an element constructed in place from args after index at, returns it
+    template <typename... Args>
+    T& emplaceAfter(size_t at, Args&&... args) {
+        DoublyLinkedListNode<T>* node = getNode(at);
+        if (node == nullptr) throw IllegalIndexException(at);
+        return link(node, node->next, std::forward<Args>(args)...)->value;
+    }
+
+    // Inserts value right before the element at position (at the end of the list for end()), returns its iterator
+    iterator insertBefore(iterator position, const T& value) {
+        return emplaceBefore(position, value);
+    }
+
+    iterator insertBefore(iterator position, T&& value) {
+        return emplaceBefore(position, std::move(value));
+    }
+
+    template <typename... Args>
+    iterator emplaceBefore(iterator position, Args&&... args) {
+        return iterator(link(position.current == nullptr ? tail : position.current->previous, position.current, std::forward<Args>(args)...));
+    }
+
+    void erase(size_t at) {
+        DoublyLinkedListNode<T>* node = getNode(at);
+        if (node == nullptr) throw IllegalIndexException(at);
+        unlink(node);
+    }
+
+    // Removes the element at position in O(1), returns an iterator to the element that followed it
+    iterator erase(iterator position) {
+        if (position.current == nullptr) throw IllegalAccessException();
+        iterator next(position.current->next);
+        unlink(position.current);
+        return next;
+    }
+
+    void clear() {
+        clear(head);
+        head = nullptr;
+        tail = nullptr;
+        count = 0;
+    }
+
+    void swap(DoublyLinkedList& other) noexcept {
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(count, other.count);
+        std::swap(allocator, other.allocator);
+    }
+};
+
+#endif
@@ -0,0 +1,208 @@
+#ifndef EPOCH_RECLAMATION_HPP
+#define EPOCH_RECLAMATION_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*
+ * Epoch based reclamation (K. Fraser, Practical lock-freedom, 2004), for lock-free containers whose operations hold
+ * too many references at once for hazard pointers. A thread pins the current global epoch in its own record for as
+ * long as it may read shared nodes. Unlinked nodes are retired with the epoch they were unlinked in, and deleted once
+ * the global epoch has moved two steps further: it only moves once every pinned thread has seen its current value,
+ * so no thread can still hold a reference to them by then.
+ * Each thread writes to its own record only, the global epoch being read on every pin but rarely written.
+ */
+class EpochReclamation {
+public:
+    // Retired nodes a thread keeps before trying to reclaim them
+    static constexpr size_t RetiredThreshold = 64;
+private:
+    static constexpr uint64_t Idle = ~uint64_t(0);
+
+    struct Retired {
+        void* pointer;
+        void (*deleter)(void*);
+        uint64_t epoch;
+    };
+
+    struct alignas(64) Record {
+        std::atomic<bool> active;
+        // Epoch pinned by the owning thread, or Idle
+        std::atomic<uint64_t> epoch;
+        // Nodes its last owner left behind when exiting, since they could not be reclaimed yet
+        std::atomic<bool> orphaned;
+        std::vector<Retired> orphans;
+        Record* next;
+    };
+
+    // Records are never freed, a thread exiting releases its record for the next thread to come
+    static inline std::atomic<Record*> records{nullptr};
+    alignas(64) static inline std::atomic<uint64_t> globalEpoch{0};
+
+    class ThreadState {
+        Record* record = nullptr;
+        size_t depth = 0;
+        std::vector<Retired> retired;
+
+        void acquireRecord() {
+            for (Record* current = records.load(std::memory_order_acquire); current != nullptr; current = current->next) {
+                bool expected = false;
+                if (!current->active.load(std::memory_order_relaxed) && current->active.compare_exchange_strong(expected, true)) {
+                    try {
+                        adoptOrphans(current);
+                    } catch (...) {
+                        current->active.store(false, std::memory_order_release);
+                        throw;
+                    }
+                    record = current;
+                    return;
+                }
+            }
+
+            Record* added = new Record();
+            added->active.store(true, std::memory_order_relaxed);
+            added->epoch.store(Idle, std::memory_order_relaxed);
+            added->orphaned.store(false, std::memory_order_relaxed);
+            Record* head = records.load(std::memory_order_relaxed);
+            do {
+                added->next = head;
+            } while (!records.compare_exchange_weak(head, added, std::memory_order_release, std::memory_order_relaxed));
+            record = added;
+        }
+
+        // Moves the global epoch one step further if every pinned thread has seen its current value
+        static void tryAdvance() noexcept {
+            uint64_t epoch = globalEpoch.load(std::memory_order_seq_cst);
+            for (Record* current = records.load(std::memory_order_acquire); current != nullptr; current = current->next) {
+                uint64_t pinned = current->epoch.load(std::memory_order_seq_cst);
+                if (pinned != Idle && pinned != epoch) return;
+            }
+            globalEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+
+        // Takes over the nodes left in a record this thread owns, if any
+        void adoptOrphans(Record* owned) {
+            if (!owned->orphaned.load(std::memory_order_relaxed)) return;
+            if (retired.empty()) {
+                retired.swap(owned->orphans);
+            } else {
+                retired.insert(retired.end(), owned->orphans.begin(), owned->orphans.end());
+                owned->orphans.clear();
+            }
+            owned->orphaned.store(false, std::memory_order_relaxed);
+        }
+
+        // Same for the records of all exited threads
+        void adoptOrphans() {
+            for (Record* current = records.load(std::memory_order_acquire); current != nullptr; current = current->next) {
+                if (!current->orphaned.load(std::memory_order_relaxed)) continue;
+                bool expected = false;
+                if (current->active.load(std::memory_order_relaxed) || !current->active.compare_exchange_strong(expected, true)) continue;
+                try {
+                    adoptOrphans(current);
+                } catch (...) {
+                    current->active.store(false, std::memory_order_release);
+                    throw;
+                }
+                current->active.store(false, std::memory_order_release);
+            }
+        }
+
+        // Deletes every retired node unlinked at least two epochs ago
+        void reclaim() noexcept {
+            uint64_t epoch = globalEpoch.load(std::memory_order_seq_cst);
+            size_t kept = 0;
+            for (size_t i = 0; i < retired.size(); i++) {
+                if (retired[i].epoch + 2 <= epoch) {
+                    retired[i].deleter(retired[i].pointer);
+                } else {
+                    retired[kept++] = retired[i];
+                }
+            }
+            retired.resize(kept);
+        }
+    public:
+        ~ThreadState() {
+            if (record == nullptr) return;
+            // Every pinned thread left its epoch behind unless one is busy for long, hand over what remains then
+            for (int attempt = 0; attempt < 3 && !retired.empty(); attempt++) {
+                tryAdvance();
+                reclaim();
+            }
+            // Left in the record without allocating, for whichever thread reclaims next
+            if (!retired.empty()) {
+                record->orphans.swap(retired);
+                record->orphaned.store(true, std::memory_order_relaxed);
+            }
+            record->active.store(false, std::memory_order_release);
+        }
+
+        // Only throws when allocating the record of the thread fails, leaving it unpinned
+        void pin() {
+            if (record == nullptr) acquireRecord();
+            if (depth++ > 0) return;
+            // Publishing an epoch the global one has already left would let it move two steps without this thread
+            uint64_t epoch = globalEpoch.load(std::memory_order_seq_cst);
+            while (true) {
+                record->epoch.store(epoch, std::memory_order_seq_cst);
+                uint64_t current = globalEpoch.load(std::memory_order_seq_cst);
+                if (current == epoch) return;
+                epoch = current;
+            }
+        }
+
+        void unpin() noexcept {
+            if (--depth == 0) record->epoch.store(Idle, std::memory_order_release);
+        }
+
+        void retire(void* pointer, void (*deleter)(void*)) {
+            retired.push_back({pointer, deleter, globalEpoch.load(std::memory_order_seq_cst)});
+            if (retired.size() >= RetiredThreshold) {
+                adoptOrphans();
+                tryAdvance();
+                reclaim();
+                // A thread preempted while pinned holds the epoch back, let it run rather than keep piling up nodes
+                if (retired.size() >= 4 * RetiredThreshold) std::this_thread::yield();
+            }
+        }
+    };
+
+    static ThreadState& state() {
+        static thread_local ThreadState threadState;
+        return threadState;
+    }
+public:
+    // Keeps the nodes reachable when it was created alive for as long as it is in scope. Guards nest, and must be
+    // destroyed by the thread which created them. The first one of a thread allocates its record, and may throw.
+    class Guard {
+    public:
+        Guard() {
+            state().pin();
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        ~Guard() {
+            state().unpin();
+        }
+    };
+
+    // Deletes pointer, which must not be reachable from any shared structure anymore, once no thread that may have
+    // reached it is still pinned
+    template <typename T>
+    static void retire(T* pointer) {
+        state().retire(pointer, [](void* retired) { delete static_cast<T*>(retired); });
+    }
+
+    // Same, through the given deleter
+    static void retire(void* pointer, void (*deleter)(void*)) {
+        state().retire(pointer, deleter);
+    }
+};
+
+#endif
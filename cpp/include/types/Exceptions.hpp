@@ -20,4 +20,10 @@ public:
     IllegalAccessException() : Exception("IllegalAccessException") {}
 };
 
+// Failed file operation, with what the operating system said about it
+class IOException : public Exception {
+public:
+    IOException(const std::string& message) : Exception("IOException " + message) {}
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,186 @@
+#ifndef EXPRESSIONS_HPP
+#define EXPRESSIONS_HPP
+
+#include "types/Exceptions.hpp"
+#include "types/SimdKernels.hpp"
+
+#include <cstdlib>
+#include <type_traits>
+
+/*
+ * Expression templates for element-wise arithmetic over Array, Vector and SmallVector of arithmetic elements.
+ * Operators only record their operands, and the whole expression is computed in a single vectorized pass, without
+ * any temporary, once assigned to a container:
+ *   Vector<float> result = a + b * c - 1.0f;
+ * Scalars apply to every element. Expressions reference the containers they were built from and must not outlive
+ * them, so they are meant to be assigned right away rather than stored.
+ */
+
+// Specialized by the containers which can be used as operands, value_type being their element type
+template <typename C>
+struct ExpressionContainer : std::false_type {};
+
+template <typename T>
+class ContainerExpression {
+    const T* values;
+    size_t count;
+public:
+    typedef T value_type;
+    static constexpr bool isScalar = false;
+
+    ContainerExpression(const T* values, size_t count) noexcept : values(values), count(count) {}
+
+    ALGORITHMIC_INLINE T operator[](size_t i) const noexcept {
+        return values[i];
+    }
+
+    size_t size() const noexcept {
+        return count;
+    }
+};
+
+template <typename T>
+class ScalarExpression {
+    T value;
+public:
+    typedef T value_type;
+    static constexpr bool isScalar = true;
+
+    ScalarExpression(T value) noexcept : value(value) {}
+
+    ALGORITHMIC_INLINE T operator[](size_t) const noexcept {
+        return value;
+    }
+
+    size_t size() const noexcept {
+        return 0;
+    }
+};
+
+// Throws IllegalAccessException when combining operands of different sizes
+template <typename T, typename L, typename R, typename Operation>
+class BinaryExpression {
+    L left;
+    R right;
+public:
+    typedef T value_type;
+    static constexpr bool isScalar = false;
+
+    BinaryExpression(const L& left, const R& right) : left(left), right(right) {
+        if (!L::isScalar && !R::isScalar && left.size() != right.size()) throw IllegalAccessException();
+    }
+
+    ALGORITHMIC_INLINE T operator[](size_t i) const noexcept {
+        return Operation::apply(left[i], right[i]);
+    }
+
+    size_t size() const noexcept {
+        return L::isScalar ? right.size() : left.size();
+    }
+};
+
+// The casts bring back the results of operations on small integers, promoted to int, to their type
+struct AddOperation {
+    template <typename T>
+    static ALGORITHMIC_INLINE T apply(T a, T b) noexcept { return static_cast<T>(a + b); }
+};
+
+struct SubtractOperation {
+    template <typename T>
+    static ALGORITHMIC_INLINE T apply(T a, T b) noexcept { return static_cast<T>(a - b); }
+};
+
+struct MultiplyOperation {
+    template <typename T>
+    static ALGORITHMIC_INLINE T apply(T a, T b) noexcept { return static_cast<T>(a * b); }
+};
+
+struct DivideOperation {
+    template <typename T>
+    static ALGORITHMIC_INLINE T apply(T a, T b) noexcept { return static_cast<T>(a / b); }
+};
+
+// Whether E is the result of an operator, that containers can be built from
+template <typename E>
+struct IsExpression : std::false_type {};
+
+template <typename T, typename L, typename R, typename Operation>
+struct IsExpression<BinaryExpression<T, L, R, Operation>> : std::true_type {};
+
+// How containers and expressions turn into operands, anything else is not one
+template <typename X, typename = void>
+struct ExpressionOperand {
+    static constexpr bool valid = false;
+};
+
+template <typename C>
+struct ExpressionOperand<C, std::enable_if_t<ExpressionContainer<C>::value>> {
+    static constexpr bool valid = true;
+    typedef typename ExpressionContainer<C>::value_type value_type;
+    typedef ContainerExpression<value_type> type;
+
+    static type make(const C& container) noexcept {
+        return type(container.begin(), container.size());
+    }
+};
+
+template <typename E>
+struct ExpressionOperand<E, std::enable_if_t<IsExpression<E>::value>> {
+    static constexpr bool valid = true;
+    typedef typename E::value_type value_type;
+    typedef E type;
+
+    static const type& make(const E& expression) noexcept {
+        return expression;
+    }
+};
+
+// Two operands of the same element type, or one operand and an arithmetic scalar
+template <typename L, typename R>
+constexpr bool areExpressionOperands() noexcept {
+    if constexpr (ExpressionOperand<L>::valid && ExpressionOperand<R>::valid) {
+        return std::is_same<typename ExpressionOperand<L>::value_type, typename ExpressionOperand<R>::value_type>::value;
+    } else {
+        return (ExpressionOperand<L>::valid && std::is_arithmetic<R>::value) || (std::is_arithmetic<L>::value && ExpressionOperand<R>::valid);
+    }
+}
+
+template <typename Operation, typename L, typename R>
+auto makeExpression(const L& left, const R& right) {
+    if constexpr (!ExpressionOperand<R>::valid) {
+        typedef typename ExpressionOperand<L>::value_type T;
+        typedef typename ExpressionOperand<L>::type Left;
+        return BinaryExpression<T, Left, ScalarExpression<T>, Operation>(ExpressionOperand<L>::make(left), ScalarExpression<T>(static_cast<T>(right)));
+    } else if constexpr (!ExpressionOperand<L>::valid) {
+        typedef typename ExpressionOperand<R>::value_type T;
+        typedef typename ExpressionOperand<R>::type Right;
+        return BinaryExpression<T, ScalarExpression<T>, Right, Operation>(ScalarExpression<T>(static_cast<T>(left)), ExpressionOperand<R>::make(right));
+    } else {
+        typedef typename ExpressionOperand<L>::value_type T;
+        typedef typename ExpressionOperand<L>::type Left;
+        typedef typename ExpressionOperand<R>::type Right;
+        return BinaryExpression<T, Left, Right, Operation>(ExpressionOperand<L>::make(left), ExpressionOperand<R>::make(right));
+    }
+}
+
+template <typename L, typename R, typename = std::enable_if_t<areExpressionOperands<L, R>()>>
+auto operator+(const L& left, const R& right) {
+    return makeExpression<AddOperation>(left, right);
+}
+
+template <typename L, typename R, typename = std::enable_if_t<areExpressionOperands<L, R>()>>
+auto operator-(const L& left, const R& right) {
+    return makeExpression<SubtractOperation>(left, right);
+}
+
+template <typename L, typename R, typename = std::enable_if_t<areExpressionOperands<L, R>()>>
+auto operator*(const L& left, const R& right) {
+    return makeExpression<MultiplyOperation>(left, right);
+}
+
+template <typename L, typename R, typename = std::enable_if_t<areExpressionOperands<L, R>()>>
+auto operator/(const L& left, const R& right) {
+    return makeExpression<DivideOperation>(left, right);
+}
+
+#endif
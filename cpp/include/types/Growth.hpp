@@ -0,0 +1,69 @@
+#ifndef GROWTH_HPP
+#define GROWTH_HPP
+
+#include <cstddef>
+
+/*
+ * Growth policies of Vector, deciding its capacity when it runs out of room. A policy provides:
+ *  - static size_t grow(size_t capacity, size_t elementSize): the capacity following capacity, greater than it
+ *  - static size_t round(size_t capacity, size_t elementSize): the capacity actually allocated when capacity
+ *    elements are needed, at least capacity
+ * reserveExact bypasses both.
+ */
+
+// 0, 1, 2, 4, 8...
+struct DoublingGrowth {
+    static size_t grow(size_t capacity, size_t) noexcept {
+        return capacity == 0 ? 1 : capacity * 2;
+    }
+
+    static size_t round(size_t capacity, size_t) noexcept {
+        return capacity;
+    }
+};
+
+// 0, 1, 2, 3, 4, 6, 9, 13... Below the golden ratio, the blocks freed while growing eventually add up to the next
+// one, which the memory allocator can then reuse
+struct OneAndHalfGrowth {
+    static size_t grow(size_t capacity, size_t) noexcept {
+        return capacity < 2 ? capacity + 1 : capacity + capacity / 2;
+    }
+
+    static size_t round(size_t capacity, size_t) noexcept {
+        return capacity;
+    }
+};
+
+// Grows as Base does, but allocates whole pages once past a page, where the allocator would map them anyway
+template <typename Base = DoublingGrowth, size_t PageSize = 4096>
+struct PageRoundedGrowth {
+    static_assert(PageSize > 0 && (PageSize & (PageSize - 1)) == 0, "PageSize must be a power of two");
+
+    static size_t grow(size_t capacity, size_t elementSize) noexcept {
+        return Base::grow(capacity, elementSize);
+    }
+
+    static size_t round(size_t capacity, size_t elementSize) noexcept {
+        capacity = Base::round(capacity, elementSize);
+        size_t bytes = capacity * elementSize;
+        if (bytes < PageSize) return capacity;
+        return ((bytes + PageSize - 1) & ~(PageSize - 1)) / elementSize;
+    }
+};
+
+// Grows as Base does up to ChunkBytes, then by ChunkBytes at a time, so that very large vectors never reserve
+// gigabytes they may not use
+template <size_t ChunkBytes = (size_t(256) << 20), typename Base = DoublingGrowth>
+struct ChunkedGrowth {
+    static size_t grow(size_t capacity, size_t elementSize) noexcept {
+        if (capacity * elementSize < ChunkBytes) return Base::grow(capacity, elementSize);
+        size_t chunk = ChunkBytes / elementSize;
+        return capacity + (chunk > 0 ? chunk : 1);
+    }
+
+    static size_t round(size_t capacity, size_t elementSize) noexcept {
+        return Base::round(capacity, elementSize);
+    }
+};
+
+#endif
@@ -0,0 +1,135 @@
+#ifndef HAZARD_POINTERS_HPP
+#define HAZARD_POINTERS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*
+ * Hazard pointers (M. Michael, 2004), the safe memory reclamation scheme of the lock-free containers.
+ * Before dereferencing a shared node, a thread publishes its address in one of its hazard slots through protect().
+ * Unlinked nodes are handed to retire(), and only deleted once no thread has them published anymore.
+ * Each thread owns SlotsPerThread slots, reused across all containers.
+ */
+class HazardPointers {
+public:
+    static constexpr size_t SlotsPerThread = 2;
+private:
+    struct alignas(64) Record {
+        std::atomic<bool> active;
+        std::atomic<void*> pointers[SlotsPerThread];
+        Record* next;
+    };
+
+    struct Retired {
+        void* pointer;
+        void (*deleter)(void*);
+    };
+
+    // Records are never freed, a thread exiting releases its record for the next thread to come
+    static inline std::atomic<Record*> records{nullptr};
+    static inline std::atomic<size_t> recordCount{0};
+
+    class ThreadState {
+        Record* record = nullptr;
+        std::vector<Retired> retired;
+
+        void acquireRecord() {
+            for (Record* current = records.load(std::memory_order_acquire); current != nullptr; current = current->next) {
+                bool expected = false;
+                if (!current->active.load(std::memory_order_relaxed) && current->active.compare_exchange_strong(expected, true)) {
+                    record = current;
+                    return;
+                }
+            }
+
+            Record* added = new Record();
+            added->active.store(true, std::memory_order_relaxed);
+            for (auto& pointer: added->pointers) pointer.store(nullptr, std::memory_order_relaxed);
+            Record* head = records.load(std::memory_order_relaxed);
+            do {
+                added->next = head;
+            } while (!records.compare_exchange_weak(head, added, std::memory_order_release, std::memory_order_relaxed));
+            recordCount.fetch_add(1, std::memory_order_relaxed);
+            record = added;
+        }
+    public:
+        ~ThreadState() {
+            if (record == nullptr) return;
+            for (auto& pointer: record->pointers) pointer.store(nullptr, std::memory_order_release);
+            // Hazards are only held for the duration of a single operation, the remaining nodes free up quickly
+            while (!retired.empty()) {
+                scan();
+                if (!retired.empty()) std::this_thread::yield();
+            }
+            record->active.store(false, std::memory_order_release);
+        }
+
+        std::atomic<void*>& slot(size_t index) {
+            if (record == nullptr) acquireRecord();
+            return record->pointers[index];
+        }
+
+        void retire(void* pointer, void (*deleter)(void*)) {
+            retired.push_back({pointer, deleter});
+            if (retired.size() >= 2 * SlotsPerThread * recordCount.load(std::memory_order_relaxed) + 64) scan();
+        }
+
+        // Deletes every retired node that no thread currently protects
+        void scan() {
+            std::vector<void*> hazards;
+            for (Record* current = records.load(std::memory_order_acquire); current != nullptr; current = current->next) {
+                for (auto& pointer: current->pointers) {
+                    void* hazard = pointer.load(std::memory_order_seq_cst);
+                    if (hazard != nullptr) hazards.push_back(hazard);
+                }
+            }
+
+            std::sort(hazards.begin(), hazards.end());
+
+            size_t kept = 0;
+            for (size_t i = 0; i < retired.size(); i++) {
+                if (std::binary_search(hazards.begin(), hazards.end(), retired[i].pointer)) {
+                    retired[kept++] = retired[i];
+                } else {
+                    retired[i].deleter(retired[i].pointer);
+                }
+            }
+            retired.resize(kept);
+        }
+    };
+
+    static ThreadState& state() {
+        static thread_local ThreadState threadState;
+        return threadState;
+    }
+public:
+    // Publishes the pointer currently held by source in the given slot, and returns it once the publication is
+    // known to have happened before it could be retired
+    template <typename T>
+    static T* protect(size_t slot, const std::atomic<T*>& source) {
+        std::atomic<void*>& hazard = state().slot(slot);
+        T* pointer = source.load(std::memory_order_relaxed);
+        while (true) {
+            hazard.store(pointer, std::memory_order_seq_cst);
+            T* current = source.load(std::memory_order_seq_cst);
+            if (current == pointer) return pointer;
+            pointer = current;
+        }
+    }
+
+    static void clear(size_t slot) {
+        state().slot(slot).store(nullptr, std::memory_order_release);
+    }
+
+    // Deletes pointer, which must not be reachable from any shared structure anymore, once it is not protected
+    template <typename T>
+    static void retire(T* pointer) {
+        state().retire(pointer, [](void* retired) { delete static_cast<T*>(retired); });
+    }
+};
+
+#endif
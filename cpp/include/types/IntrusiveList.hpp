@@ -0,0 +1,213 @@
+#ifndef INTRUSIVE_LIST_HPP
+#define INTRUSIVE_LIST_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include "types/Exceptions.hpp"
+#include <utility>
+
+// Links embedded in the elements of an IntrusiveList. Copying an element never copies its links.
+struct IntrusiveListHook {
+    IntrusiveListHook* previous = nullptr;
+    IntrusiveListHook* next = nullptr;
+
+    IntrusiveListHook() noexcept {}
+    IntrusiveListHook(const IntrusiveListHook&) noexcept {}
+    IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept { return *this; }
+
+    bool linked() const noexcept {
+        return next != nullptr;
+    }
+};
+
+/*
+ * Doubly linked list of elements it does not own, linked together through their IntrusiveListHook member Hook:
+ *   struct Timer { long deadline; IntrusiveListHook hook; };
+ *   IntrusiveList<Timer, &Timer::hook> timers;
+ * It never allocates, and every removal is O(1). An element can only be in one list per hook at a time, and must
+ * be removed from it before being destroyed.
+ */
+template <typename T, IntrusiveListHook T::*Hook>
+class IntrusiveList {
+    // Circular list, the sentinel stands both before the first and after the last element
+    IntrusiveListHook sentinel;
+    size_t count;
+    // Offset of Hook inside T, measured on the elements as they are linked, so that elements are only ever found
+    // back from the hooks of linked elements
+    std::ptrdiff_t offset = 0;
+
+    static IntrusiveListHook* hookOf(T& element) noexcept {
+        return &(element.*Hook);
+    }
+
+    static std::ptrdiff_t hookOffset(T& element) noexcept {
+        return reinterpret_cast<unsigned char*>(hookOf(element)) - reinterpret_cast<unsigned char*>(&element);
+    }
+
+    static T* elementOf(IntrusiveListHook* hook, std::ptrdiff_t offset) noexcept {
+        return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(hook) - offset);
+    }
+
+    T* elementOf(IntrusiveListHook* hook) const noexcept {
+        return elementOf(hook, offset);
+    }
+
+    void linkBefore(IntrusiveListHook* position, T& element) {
+        IntrusiveListHook* hook = hookOf(element);
+        if (hook->linked()) throw IllegalAccessException();
+        offset = hookOffset(element);
+        hook->previous = position->previous;
+        hook->next = position;
+        position->previous->next = hook;
+        position->previous = hook;
+        count++;
+    }
+
+    void unlink(IntrusiveListHook* hook) noexcept {
+        hook->previous->next = hook->next;
+        hook->next->previous = hook->previous;
+        hook->previous = nullptr;
+        hook->next = nullptr;
+        count--;
+    }
+
+    // Points the neighbours of the sentinel back to it, e.g. once it has been moved
+    void relink() noexcept {
+        if (count == 0) {
+            sentinel.previous = sentinel.next = &sentinel;
+        } else {
+            sentinel.next->previous = &sentinel;
+            sentinel.previous->next = &sentinel;
+        }
+    }
+public:
+    class Iterator {
+        friend class IntrusiveList;
+    private:
+        IntrusiveListHook* current;
+        std::ptrdiff_t offset;
+    public:
+        Iterator(IntrusiveListHook* current = nullptr, std::ptrdiff_t offset = 0) : current(current), offset(offset) {}
+        bool operator==(const Iterator& other) const noexcept { return current == other.current; }
+        bool operator!=(const Iterator& other) const noexcept { return current != other.current; }
+        T& operator*() const { return *elementOf(current, offset); }
+        T* operator->() const { return elementOf(current, offset); }
+        Iterator operator++() {
+            Iterator tmp = Iterator(current, offset);
+            current = current->next;
+            return tmp;
+        }
+        Iterator operator--() {
+            Iterator tmp = Iterator(current, offset);
+            current = current->previous;
+            return tmp;
+        }
+    };
+
+    typedef Iterator iterator;
+    iterator begin() const { return iterator(sentinel.next, offset); }
+    iterator end() const { return iterator(const_cast<IntrusiveListHook*>(&sentinel), offset); }
+
+    IntrusiveList() : count(0) {
+        relink();
+    }
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    IntrusiveList(IntrusiveList&& other) noexcept : IntrusiveList() {
+        swap(other);
+    }
+
+    IntrusiveList& operator=(IntrusiveList&& other) noexcept {
+        if (this == &other) return *this;
+        clear();
+        swap(other);
+        return *this;
+    }
+
+    ~IntrusiveList() {
+        clear();
+    }
+
+    T& operator[](size_t at) const {
+        if (at >= count) throw IllegalIndexException(at);
+        IntrusiveListHook* current = sentinel.next;
+        for (size_t i = 0; i < at; i++) current = current->next;
+        return *elementOf(current);
+    }
+
+    bool empty() const noexcept {
+        return count == 0;
+    }
+
+    size_t size() const noexcept {
+        return count;
+    }
+
+    T& first() const {
+        if (empty()) throw IllegalAccessException();
+        return *elementOf(sentinel.next);
+    }
+
+    T& last() const {
+        if (empty()) throw IllegalAccessException();
+        return *elementOf(sentinel.previous);
+    }
+
+    // Throws IllegalAccessException if the element already is in a list through Hook
+    void push(T& element) {
+        linkBefore(&sentinel, element);
+    }
+
+    void pushFront(T& element) {
+        linkBefore(sentinel.next, element);
+    }
+
+    void insertBefore(iterator position, T& element) {
+        linkBefore(position.current, element);
+    }
+
+    void pop() noexcept {
+        if (!empty()) unlink(sentinel.previous);
+    }
+
+    void popFront() noexcept {
+        if (!empty()) unlink(sentinel.next);
+    }
+
+    // Removes element, which must belong to this list, in O(1). Throws IllegalAccessException if it is in no list
+    // through Hook.
+    void erase(T& element) {
+        IntrusiveListHook* hook = hookOf(element);
+        if (!hook->linked()) throw IllegalAccessException();
+        unlink(hook);
+    }
+
+    // Removes the element at position, returns an iterator to the element that followed it
+    iterator erase(iterator position) noexcept {
+        iterator next(position.current->next, offset);
+        unlink(position.current);
+        return next;
+    }
+
+    void clear() noexcept {
+        while (!empty()) unlink(sentinel.next);
+    }
+
+    void swap(IntrusiveList& other) noexcept {
+        // Hooks are not copied by their own assignment operator, swap their links explicitly
+        std::swap(count, other.count);
+        std::swap(offset, other.offset);
+        IntrusiveListHook* previous = sentinel.previous;
+        IntrusiveListHook* next = sentinel.next;
+        sentinel.previous = other.sentinel.previous;
+        sentinel.next = other.sentinel.next;
+        other.sentinel.previous = previous;
+        other.sentinel.next = next;
+        relink();
+        other.relink();
+    }
+};
+
+#endif
@@ -3,33 +3,103 @@
 
 #include <cstdlib>
 #include "types/Exceptions.hpp"
+#include "types/NodePool.hpp"
 #include <array>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 template <typename T>
 struct LinkedListNode {
     T value;
     LinkedListNode<T>* next = nullptr;
-    LinkedListNode(T value, LinkedListNode<T>* next = nullptr) : value(value), next(next) {}
+    LinkedListNode(T value, LinkedListNode<T>* next = nullptr) : value(std::move(value)), next(next) {}
+    // Constructs the value in place from args
+    template <typename... Args>
+    LinkedListNode(std::in_place_t, LinkedListNode<T>* next, Args&&... args) : value(std::forward<Args>(args)...), next(next) {}
 };
 
-template <typename T>
+template <typename T, typename Allocator = NodePool<LinkedListNode<T>>>
 class LinkedList {
     LinkedListNode<T>* head;
+    LinkedListNode<T>* tail;
+    size_t count;
+    Allocator allocator;
+    // Last node reached by getNode, positional accesses at or past it resume from there instead of from head.
+    // Being updated by const accessors, it makes concurrent reads of a same list unsafe.
+    mutable LinkedListNode<T>* cursor;
+    mutable size_t cursorIndex;
+
+    template <typename... Args>
+    LinkedListNode<T>* createNode(LinkedListNode<T>* next, Args&&... args) {
+        LinkedListNode<T>* node = allocator.allocate();
+        try {
+            ::new (static_cast<void*>(node)) LinkedListNode<T>(std::in_place, next, std::forward<Args>(args)...);
+        } catch (...) {
+            allocator.deallocate(node);
+            throw;
+        }
+        return node;
+    }
+
+    void destroyNode(LinkedListNode<T>* node) noexcept {
+        node->~LinkedListNode<T>();
+        allocator.deallocate(node);
+    }
 
     LinkedListNode<T>* getNode(size_t at) const noexcept {
+        if (at >= count) return nullptr;
+        if (at == count - 1) return tail;
         LinkedListNode<T>* current = head;        
-        for (size_t i = 0; i < at; i++) {
-            if (current == nullptr) return nullptr;
-            current = current->next;
+        size_t i = 0;
+        if (cursor != nullptr && cursorIndex <= at) {
+            current = cursor;
+            i = cursorIndex;
         }
+        for (; i < at; i++) current = current->next;
+        cursor = current;
+        cursorIndex = at;
         return current;
     }
 
+    void resetCursor() const noexcept {
+        cursor = nullptr;
+        cursorIndex = 0;
+    }
+
     void clear(LinkedListNode<T>* node) {
-        if (node == nullptr) return;
-        if (node->next != nullptr) clear(node->next);
-        delete node;
+        if (!allocator.releasesInBulk()) {
+            while (node != nullptr) {
+                LinkedListNode<T>* next = node->next;
+                destroyNode(node);
+                node = next;
+            }
+        } else if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (; node != nullptr; node = node->next) node->value.~T();
+        }
+        allocator.release();
     } 
+
+    // Merges two sorted chains of nodes, taking from left on ties
+    template <typename Compare>
+    static LinkedListNode<T>* merge(LinkedListNode<T>* left, LinkedListNode<T>* right, Compare& compare) {
+        LinkedListNode<T>* result;
+        LinkedListNode<T>** link = &result;
+        while (left != nullptr && right != nullptr) {
+            if (compare(right->value, left->value)) {
+                *link = right;
+                link = &right->next;
+                right = right->next;
+            } else {
+                *link = left;
+                link = &left->next;
+                left = left->next;
+            }
+        }
+        *link = left != nullptr ? left : right;
+        return result;
+    }
 public:
     class Iterator {
         friend class LinkedList;
@@ -37,8 +107,8 @@ public:
         LinkedListNode<T>* current;
         public:
         Iterator(LinkedListNode<T> *current = nullptr) : current(current) {}
-        bool operator==(Iterator& other) noexcept { return current == other.current; } 
-        bool operator!=(Iterator& other) noexcept { return current != other.current; } 
+        bool operator==(const Iterator& other) const noexcept { return current == other.current; } 
+        bool operator!=(const Iterator& other) const noexcept { return current != other.current; } 
         T& operator*() const { return current->value; }
         Iterator operator++() {
             Iterator tmp = Iterator(current);
@@ -51,42 +121,39 @@ public:
     iterator begin() const { return iterator(head);  }
     iterator end() const { return iterator(nullptr); }
 
-    LinkedList() : head(nullptr) {}
+    LinkedList() : head(nullptr), tail(nullptr), count(0), cursor(nullptr), cursorIndex(0) {}
 
-    LinkedList(LinkedList<T>& other) { 
-        head = nullptr; 
+    LinkedList(LinkedList& other) : LinkedList() { 
         for(auto& value: other) push(value); 
     }
     
-    LinkedList(const LinkedList<T>& other) { 
-        head = nullptr; 
+    LinkedList(const LinkedList& other) : LinkedList() { 
         for(auto& value: other) push(value); 
     }
     
-    LinkedList(LinkedList<T>&& other) { 
-        head = other.head; 
-        other.head = nullptr; 
+    LinkedList(LinkedList&& other) noexcept : LinkedList() { 
+        swap(other);
     }
     
     ~LinkedList() { 
         clear(); 
     }
 
-    LinkedList& operator=(LinkedList<T>& other) noexcept { 
-        clear(); 
-        for(auto& value: other) push(value); 
-        return *this;
+    LinkedList& operator=(LinkedList& other) { 
+        return (*this) = (const LinkedList&)other;
     }
     
-    LinkedList& operator=(const LinkedList<T>& other) noexcept { 
+    LinkedList& operator=(const LinkedList& other) { 
+        if (this == &other) return *this;
         clear(); 
         for(auto& value: other) push(value); 
         return *this;
     }
     
-    LinkedList& operator=(LinkedList<T>&& other) noexcept {
-        head = other->head; 
-        other->head = nullptr; 
+    LinkedList& operator=(LinkedList&& other) noexcept {
+        if (this == &other) return *this;
+        clear();
+        swap(other);
         return *this;
     }
 
@@ -102,91 +169,233 @@ public:
         return node->value;
     }
 
-    bool operator==(const LinkedList<T>& other) const noexcept {
-        size_t length = size();
-        if (length != other.size()) return false;
-        for(size_t i = 0; i < length; i++) {
-            if ((*this)[i] != other[i]) return false;
+    bool operator==(const LinkedList& other) const noexcept {
+        if (size() != other.size()) return false;
+        iterator it = other.begin();
+        for(const auto& value: *this) {
+            if (value != *it) return false;
+            ++it;
         }
         return true;
     }
 
-    bool operator!=(const LinkedList<T>& other) const noexcept {
+    bool operator!=(const LinkedList& other) const noexcept {
         return !((*this) == other);
     }
 
     bool empty() const noexcept {
-        return size() == 0; 
+        return count == 0; 
     }
 
     size_t size() const noexcept {
-        if (head == nullptr) return 0;
-
-        LinkedListNode<T>* current = head;
-        size_t count = 1;
-        while (current->next != nullptr) {
-            count++;
-            current = current->next;
-        }
         return count;
     }
 
-    void push(const T& value) noexcept {
-        LinkedListNode<T>* added = new LinkedListNode<T>(value, nullptr);
+    void push(const T& value) {
+        emplace(value);
+    }
+
+    void push(T&& value) {
+        emplace(std::move(value));
+    }
+
+    // Appends an element constructed in place from args, returns it
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        LinkedListNode<T>* added = createNode(nullptr, std::forward<Args>(args)...);
         if(empty()) {
             head = added;
         } else {
-            LinkedListNode<T>* tail = head;
-            while(tail->next != nullptr) tail = tail->next;
             tail->next = added;
         }
+        tail = added;
+        count++;
+        return added->value;
     }
 
     void pop() noexcept {
         if (empty()) return;
         if (head->next == nullptr) {
-            delete head;
+            destroyNode(head);
             head = nullptr;
+            tail = nullptr;
+            resetCursor();
         } else {
-            LinkedListNode<T>* previous = head;
-            while(previous != nullptr && previous->next != nullptr && previous->next->next != nullptr) previous = previous->next;
-            delete previous->next;
+            LinkedListNode<T>* previous = getNode(count - 2);
+            destroyNode(tail);
             previous->next = nullptr;
+            tail = previous;
         }  
+        count--;
     }
 
     void insertBefore(size_t at, const T& value) {
+        emplaceBefore(at, value);
+    }
+
+    void insertBefore(size_t at, T&& value) {
+        emplaceBefore(at, std::move(value));
+    }
+
+    void insertAfter(size_t at, const T& value) {
+        emplaceAfter(at, value);
+    }
+
+    void insertAfter(size_t at, T&& value) {
+        emplaceAfter(at, std::move(value));
+    }
+
+    // Inserts an element constructed in place from args before index at, returns it
+    template <typename... Args>
+    T& emplaceBefore(size_t at, Args&&... args) {
         if (at == 0) {
-            head = new LinkedListNode<T>(value, head == nullptr ? nullptr : head->next);
-        } else {
-            insertAfter(at - 1, value);
+            head = createNode(head, std::forward<Args>(args)...);
+            if (tail == nullptr) tail = head;
+            count++;
+            if (cursor != nullptr) cursorIndex++;
+            return head->value;
         }
+        return emplaceAfter(at - 1, std::forward<Args>(args)...);
     }
 
-    void insertAfter(size_t at, const T& value) {
+    // Inserts an element constructed in place from args after index at, returns it
+    template <typename... Args>
+    T& emplaceAfter(size_t at, Args&&... args) {
         LinkedListNode<T>* node = getNode(at);
         if (node == nullptr) throw IllegalIndexException(at);
-        node->next = new LinkedListNode<T>(value, node->next);
+        node->next = createNode(node->next, std::forward<Args>(args)...);
+        if (node == tail) tail = node->next;
+        count++;
+        return node->next->value;
     }
 
     void erase(size_t at) {
-        LinkedListNode<T>* node = getNode(at);
-        if (empty() || node == nullptr) throw IllegalIndexException(at);
+        if (at >= count) throw IllegalIndexException(at);
         if (at == 0) {
+            LinkedListNode<T>* node = head;
             head = node->next;
-            delete node;
+            if (node == tail) tail = nullptr;
+            destroyNode(node);
+            if (cursor != nullptr) {
+                if (cursorIndex == 0) resetCursor(); else cursorIndex--;
+            }
         } else {
-            LinkedListNode<T>* previous = head;
-            while(previous->next != node) previous = previous->next;
+            LinkedListNode<T>* previous = getNode(at - 1);
+            LinkedListNode<T>* node = previous->next;
             previous->next = node->next;
-            delete node;
+            if (node == tail) tail = previous;
+            destroyNode(node);
         }       
+        count--;
     } 
 
+    // Moves every node of other to the end of this list, without copying any value
+    void append(LinkedList&& other) {
+        splice(count, other);
+    }
+
+    // Moves every node of other right before index at (at == size() appends them), without copying any value
+    void splice(size_t at, LinkedList& other) {
+        if (at > count) throw IllegalIndexException(at);
+        if (&other == this || other.empty()) return;
+        allocator.adopt(other.allocator);
+
+        if (at == 0) {
+            other.tail->next = head;
+            head = other.head;
+            if (tail == nullptr) tail = other.tail;
+            if (cursor != nullptr) cursorIndex += other.count;
+        } else {
+            LinkedListNode<T>* previous = getNode(at - 1);
+            other.tail->next = previous->next;
+            previous->next = other.head;
+            if (previous == tail) tail = other.tail;
+        }
+        count += other.count;
+
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.count = 0;
+        other.resetCursor();
+    }
+
+    void splice(size_t at, LinkedList&& other) {
+        splice(at, other);
+    }
+
+    // Keeps the elements before index at and returns the others, relinked into a new list
+    LinkedList splitAt(size_t at) {
+        if (at > count) throw IllegalIndexException(at);
+        LinkedList result;
+        if (at == count) return result;
+        result.allocator = allocator;
+
+        LinkedListNode<T>* previous = at == 0 ? nullptr : getNode(at - 1);
+        result.head = previous == nullptr ? head : previous->next;
+        result.tail = tail;
+        result.count = count - at;
+
+        if (previous == nullptr) {
+            head = nullptr;
+            resetCursor();
+        } else {
+            previous->next = nullptr;
+        }
+        tail = previous;
+        count = at;
+        return result;
+    }
+
+    /*
+     * Stable bottom-up merge sort, relinking the nodes without allocating or copying any value.
+     * Nodes are taken one at a time and carried through bins of sorted runs, bins[i] holding 2^i nodes, the same
+     * way a binary counter is incremented. 64 bins are enough for any list, so the extra space is constant and
+     * nothing recurses.
+     */
+    template <typename Compare = std::less<T>>
+    void sort(Compare compare = Compare()) {
+        if (count < 2) return;
+        LinkedListNode<T>* bins[64] = {};
+        LinkedListNode<T>* node = head;
+        while (node != nullptr) {
+            LinkedListNode<T>* next = node->next;
+            node->next = nullptr;
+            size_t i = 0;
+            // Runs in the bins hold earlier nodes, they go on the left to keep equal values in order
+            for (; bins[i] != nullptr; i++) {
+                node = merge(bins[i], node, compare);
+                bins[i] = nullptr;
+            }
+            bins[i] = node;
+            node = next;
+        }
+
+        node = nullptr;
+        for (LinkedListNode<T>* run: bins) {
+            if (run != nullptr) node = node == nullptr ? run : merge(run, node, compare);
+        }
+        head = node;
+        while (node->next != nullptr) node = node->next;
+        tail = node;
+        resetCursor();
+    }
+
     void clear() {
         clear(head);
         head = nullptr;
+        tail = nullptr;
+        count = 0;
+        resetCursor();
     } 
+
+    void swap(LinkedList& other) noexcept {
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(count, other.count);
+        std::swap(allocator, other.allocator);
+        std::swap(cursor, other.cursor);
+        std::swap(cursorIndex, other.cursorIndex);
+    }
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,370 @@
+#ifndef MAPPED_VECTOR_HPP
+#define MAPPED_VECTOR_HPP
+
+#include "types/BoundsCheck.hpp"
+#include "types/BulkOperations.hpp"
+#include "types/Exceptions.hpp"
+#include "types/Growth.hpp"
+#include "types/Vector.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+enum class MappedAccess {
+    ReadWrite,
+    // Mapped read only, the size cannot change and elements must not be written through the non const accessors
+    ReadOnly
+};
+
+// Access pattern hints given to the kernel through madvise
+enum class AccessPattern {
+    Normal = MADV_NORMAL,
+    // Aggressive read ahead, pages behind are dropped early
+    Sequential = MADV_SEQUENTIAL,
+    // No read ahead
+    Random = MADV_RANDOM,
+    // Starts reading the whole file in the background
+    WillNeed = MADV_WILLNEED
+};
+
+/*
+ * Vector of trivially copyable elements stored in a file mapped in memory, so that reopening it gives access to
+ * its elements right away, without reading nor parsing anything: pages are loaded on first access, and may be
+ * evicted and reloaded by the kernel, which allows datasets larger than the memory.
+ * The file starts with a 64 bytes header (magic, version, element size and count) followed by the elements, as
+ * laid out in memory on this machine. The file is extended with ftruncate and remapped with mremap as the vector
+ * grows, and cut back to its size when closed.
+ * Changes reach the file whenever the kernel writes the pages back, sync() forces it. Throws IOException when the
+ * file cannot be opened, mapped or resized, or does not hold a vector of T.
+ */
+template <typename T, typename BoundsCheck = DefaultBoundsCheck, typename Growth = DoublingGrowth>
+class MappedVector {
+    static_assert(std::is_trivially_copyable<T>::value, "MappedVector elements are stored as raw bytes");
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t elementSize;
+        uint64_t count;
+    };
+
+    static constexpr size_t HeaderSize = 64;
+    static constexpr char Magic[8] = {'A', 'L', 'G', 'O', 'V', 'E', 'C', 0};
+    static constexpr uint32_t Version = 1;
+    static_assert(alignof(T) <= HeaderSize, "MappedVector elements are aligned on 64 bytes at most");
+
+    std::string filePath;
+    int descriptor = -1;
+    bool writable = true;
+    void* mapping = nullptr;
+    size_t mappedBytes = 0;
+    T* memory = nullptr;
+    size_t allocatedSize = 0;
+    size_t count = 0;
+    AccessPattern pattern = AccessPattern::Normal;
+
+    [[noreturn]] ALGORITHMIC_COLD void fail(const char* operation) const {
+        throw IOException(std::string(operation) + " " + filePath + ": " + std::strerror(errno));
+    }
+
+    Header* header() const noexcept {
+        return static_cast<Header*>(mapping);
+    }
+
+    static size_t bytesFor(size_t size) noexcept {
+        return HeaderSize + size * sizeof(T);
+    }
+
+    void map(size_t bytes) {
+        int protection = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+        void* newMapping = mmap(nullptr, bytes, protection, MAP_SHARED, descriptor, 0);
+        if (newMapping == MAP_FAILED) fail("mmap");
+        attach(newMapping, bytes);
+    }
+
+    void attach(void* newMapping, size_t bytes) noexcept {
+        mapping = newMapping;
+        mappedBytes = bytes;
+        memory = reinterpret_cast<T*>(static_cast<char*>(mapping) + HeaderSize);
+        allocatedSize = (bytes - HeaderSize) / sizeof(T);
+        if (pattern != AccessPattern::Normal) madvise(mapping, mappedBytes, static_cast<int>(pattern));
+    }
+
+    void open() {
+        descriptor = ::open(filePath.c_str(), writable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+        if (descriptor < 0) fail("open");
+        try {
+            struct stat status;
+            if (fstat(descriptor, &status) != 0) fail("fstat");
+            size_t bytes = status.st_size;
+            if (bytes == 0 && writable) {
+                create();
+                return;
+            }
+            if (bytes < HeaderSize) throw IOException(filePath + " is not a MappedVector file");
+            map(bytes);
+            const Header* existing = header();
+            if (std::memcmp(existing->magic, Magic, sizeof(Magic)) != 0 || existing->version != Version) {
+                throw IOException(filePath + " is not a MappedVector file");
+            }
+            if (existing->elementSize != sizeof(T)) {
+                throw IOException(filePath + " holds elements of " + std::to_string(existing->elementSize) + " bytes");
+            }
+            if (existing->count > allocatedSize) throw IOException(filePath + " is truncated");
+            count = existing->count;
+        } catch (...) {
+            // Whatever the file holds, it must be left as it is
+            writable = false;
+            close();
+            throw;
+        }
+    }
+
+    void create() {
+        if (ftruncate(descriptor, bytesFor(0)) != 0) fail("ftruncate");
+        map(bytesFor(0));
+        std::memcpy(header()->magic, Magic, sizeof(Magic));
+        header()->version = Version;
+        header()->elementSize = sizeof(T);
+        header()->count = 0;
+    }
+
+    void relocate(size_t newSize) {
+        if (!writable) throw IllegalAccessException();
+        size_t bytes = bytesFor(newSize);
+        if (ftruncate(descriptor, bytes) != 0) fail("ftruncate");
+#if defined(__linux__)
+        void* newMapping = mremap(mapping, mappedBytes, bytes, MREMAP_MAYMOVE);
+        if (newMapping == MAP_FAILED) fail("mremap");
+        attach(newMapping, bytes);
+#else
+        munmap(mapping, mappedBytes);
+        mapping = nullptr;
+        map(bytes);
+#endif
+    }
+
+    void setCount(size_t newCount) noexcept {
+        count = newCount;
+        header()->count = newCount;
+    }
+
+    void grow(size_t required) {
+        size_t newSize = Growth::grow(allocatedSize, sizeof(T));
+        reserve(newSize > required ? newSize : required);
+    }
+
+    void close() noexcept {
+        if (mapping != nullptr) {
+            munmap(mapping, mappedBytes);
+            // Gives the unused capacity back to the file system
+            if (writable && mappedBytes > bytesFor(count)) {
+                int ignored = ftruncate(descriptor, bytesFor(count));
+                (void)ignored;
+            }
+        }
+        if (descriptor >= 0) ::close(descriptor);
+        descriptor = -1;
+        mapping = nullptr;
+        mappedBytes = 0;
+        memory = nullptr;
+        allocatedSize = 0;
+        count = 0;
+    }
+public:
+    // Opens the MappedVector stored at path, creating an empty one if the file does not exist (or is empty)
+    explicit MappedVector(std::string path, MappedAccess access = MappedAccess::ReadWrite) : filePath(std::move(path)), writable(access == MappedAccess::ReadWrite) {
+        open();
+    }
+
+    MappedVector(const MappedVector&) = delete;
+    MappedVector& operator=(const MappedVector&) = delete;
+
+    MappedVector(MappedVector&& other) noexcept {
+        swap(other);
+    }
+
+    MappedVector& operator=(MappedVector&& other) noexcept {
+        if (this == &other) return *this;
+        close();
+        swap(other);
+        return *this;
+    }
+
+    ~MappedVector() {
+        close();
+    }
+
+    T& operator[](size_t index) {
+        BoundsCheck::check(index, count);
+        return memory[index];
+    }
+
+    const T& operator[](size_t index) const {
+        BoundsCheck::check(index, count);
+        return memory[index];
+    }
+
+    T& at(size_t index) {
+        CheckedBounds::check(index, count);
+        return memory[index];
+    }
+
+    const T& at(size_t index) const {
+        CheckedBounds::check(index, count);
+        return memory[index];
+    }
+
+    typedef T* iterator;
+    typedef const T* const_iterator;
+
+    iterator begin() noexcept {
+        return memory;
+    }
+
+    const_iterator begin() const noexcept {
+        return memory;
+    }
+
+    const_iterator cbegin() const noexcept {
+        return memory;
+    }
+
+    iterator end() noexcept {
+        return memory + count;
+    }
+
+    const_iterator end() const noexcept {
+        return memory + count;
+    }
+
+    const_iterator cend() const noexcept {
+        return memory + count;
+    }
+
+    bool empty() const noexcept {
+        return count == 0;
+    }
+
+    size_t size() const noexcept {
+        return count;
+    }
+
+    size_t capacity() const noexcept {
+        return allocatedSize;
+    }
+
+    const std::string& path() const noexcept {
+        return filePath;
+    }
+
+    // The methods changing the size or the elements throw IllegalAccessException on read only vectors
+    void reserve(size_t newSize) {
+        if (newSize <= capacity()) return;
+        relocate(Growth::round(newSize, sizeof(T)));
+    }
+
+    void resize(size_t newSize, const T& value = {}) {
+        if (newSize == count) return;
+        if (!writable) throw IllegalAccessException();
+        if (newSize > count) {
+            T copy(value);
+            reserve(newSize);
+            std::uninitialized_fill_n(memory + count, newSize - count, copy);
+        }
+        setCount(newSize);
+    }
+
+    void push(const T& element) {
+        if (!writable) throw IllegalAccessException();
+        if (count + 1 > capacity()) {
+            T copy(element);
+            grow(count + 1);
+            memory[count] = copy;
+        } else {
+            memory[count] = element;
+        }
+        setCount(count + 1);
+    }
+
+    template <typename It, typename = std::enable_if_t<!std::is_integral<It>::value>>
+    void append(It first, It last) {
+        if (!writable) throw IllegalAccessException();
+        if constexpr (std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>::value) {
+            size_t added = std::distance(first, last);
+            // Elements of this very vector are copied out before remapping
+            if (count + added > capacity()) {
+                Vector<T> copy;
+                copy.append(first, last);
+                grow(count + added);
+                copyConstructElements(memory + count, copy.begin(), added);
+            } else {
+                std::copy(first, last, memory + count);
+            }
+            setCount(count + added);
+        } else {
+            for (; first != last; ++first) push(*first);
+        }
+    }
+
+    void pop() {
+        if (!writable) throw IllegalAccessException();
+        if (count == 0) throwIllegalIndex(0);
+        setCount(count - 1);
+    }
+
+    void clear() {
+        if (!writable) throw IllegalAccessException();
+        setCount(0);
+    }
+
+    const T& first() const {
+        return (*this)[0];
+    }
+
+    const T& last() const {
+        return (*this)[size() - 1];
+    }
+
+    void fill(const T& value) {
+        if (!writable) throw IllegalAccessException();
+        fillElements(memory, count, value);
+    }
+
+    // Applies to the whole mapping, including after growth
+    void advise(AccessPattern newPattern) noexcept {
+        pattern = newPattern;
+        madvise(mapping, mappedBytes, static_cast<int>(pattern));
+    }
+
+    // Writes the changes back to the file before returning
+    void sync() {
+        if (writable && msync(mapping, mappedBytes, MS_SYNC) != 0) fail("msync");
+    }
+
+    void swap(MappedVector& other) noexcept {
+        std::swap(filePath, other.filePath);
+        std::swap(descriptor, other.descriptor);
+        std::swap(writable, other.writable);
+        std::swap(mapping, other.mapping);
+        std::swap(mappedBytes, other.mappedBytes);
+        std::swap(memory, other.memory);
+        std::swap(allocatedSize, other.allocatedSize);
+        std::swap(count, other.count);
+        std::swap(pattern, other.pattern);
+    }
+};
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+/*
+ * Node allocators, as used by the linked containers. An allocator hands out uninitialized storage for one Node
+ * at a time and must provide:
+ *  - Node* allocate() / void deallocate(Node*)
+ *  - bool releasesInBulk() const: whether release() frees every node at once, so that the container can skip
+ *    deallocating its nodes one by one
+ *  - void release(): called once the container does not reference any node anymore
+ *  - void adopt(Allocator& other): makes the nodes of other safe to be owned (and deallocated) through this one,
+ *    other being left with none and usable on its own
+ * Copying an allocator yields one sharing the same memory, which lets containers split their nodes between them.
+ */
+
+// Plain new/delete for every node
+template <typename Node>
+class HeapNodeAllocator {
+public:
+    Node* allocate() {
+        return static_cast<Node*>(::operator new(sizeof(Node)));
+    }
+
+    void deallocate(Node* node) noexcept {
+        ::operator delete(static_cast<void*>(node));
+    }
+
+    bool releasesInBulk() const noexcept {
+        return false;
+    }
+
+    void release() noexcept {}
+
+    void adopt(HeapNodeAllocator&) noexcept {}
+};
+
+// Slab allocator carving nodes out of contiguous chunks of NodesPerChunk nodes, recycling them through an
+// intrusive free list and freeing all of its chunks at once.
+// Pools copied from one another (or merged through adopt) share the same chunks and must not be used concurrently.
+template <typename Node, size_t NodesPerChunk = 512>
+class NodePool {
+    static_assert(NodesPerChunk > 0, "NodePool chunks need room for at least one node");
+
+    union Slot {
+        Slot* next;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    struct Chunk {
+        Chunk* next;
+        Slot slots[NodesPerChunk];
+    };
+
+    struct Slab {
+        // The first chunk is the one nodes are currently carved out of
+        Chunk* chunks = nullptr;
+        Chunk* lastChunk = nullptr;
+        size_t used = NodesPerChunk;
+        Slot* freeSlots = nullptr;
+        Slot* lastFreeSlot = nullptr;
+        // Set once this slab has been merged into another one, which now owns its chunks
+        std::shared_ptr<Slab> forward;
+
+        ~Slab() {
+            while (chunks != nullptr) {
+                Chunk* next = chunks->next;
+                ::operator delete(static_cast<void*>(chunks));
+                chunks = next;
+            }
+        }
+    };
+
+    std::shared_ptr<Slab> slab;
+
+    Slab* resolve() noexcept {
+        while (slab != nullptr && slab->forward != nullptr) slab = slab->forward;
+        return slab.get();
+    }
+public:
+    NodePool() noexcept {}
+
+    Node* allocate() {
+        Slab* current = resolve();
+        if (current == nullptr) {
+            slab = std::make_shared<Slab>();
+            current = slab.get();
+        }
+
+        if (current->freeSlots != nullptr) {
+            Slot* slot = current->freeSlots;
+            current->freeSlots = slot->next;
+            if (current->freeSlots == nullptr) current->lastFreeSlot = nullptr;
+            return reinterpret_cast<Node*>(slot->storage);
+        }
+
+        if (current->used == NodesPerChunk) {
+            Chunk* chunk = static_cast<Chunk*>(::operator new(sizeof(Chunk)));
+            chunk->next = current->chunks;
+            current->chunks = chunk;
+            if (current->lastChunk == nullptr) current->lastChunk = chunk;
+            current->used = 0;
+        }
+        return reinterpret_cast<Node*>(current->chunks->slots[current->used++].storage);
+    }
+
+    void deallocate(Node* node) noexcept {
+        Slab* current = resolve();
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->next = current->freeSlots;
+        current->freeSlots = slot;
+        if (current->lastFreeSlot == nullptr) current->lastFreeSlot = slot;
+    }
+
+    bool releasesInBulk() const noexcept {
+        const Slab* current = slab.get();
+        while (current != nullptr && current->forward != nullptr) current = current->forward.get();
+        return current == nullptr || (current == slab.get() && slab.use_count() == 1);
+    }
+
+    void release() noexcept {
+        slab.reset();
+    }
+
+    void adopt(NodePool& other) {
+        Slab* current = resolve();
+        Slab* adopted = other.resolve();
+        if (adopted == nullptr || adopted == current) return;
+        if (current == nullptr) {
+            slab = std::move(other.slab);
+            return;
+        }
+
+        if (adopted->chunks != nullptr) {
+            // Keep carving nodes out of our own current chunk, the adopted ones go right after it
+            adopted->lastChunk->next = current->chunks->next;
+            current->chunks->next = adopted->chunks;
+            if (current->lastChunk == current->chunks) current->lastChunk = adopted->lastChunk;
+            adopted->chunks = nullptr;
+            adopted->lastChunk = nullptr;
+        }
+
+        if (adopted->freeSlots != nullptr) {
+            adopted->lastFreeSlot->next = current->freeSlots;
+            if (current->freeSlots == nullptr) current->lastFreeSlot = adopted->lastFreeSlot;
+            current->freeSlots = adopted->freeSlots;
+            adopted->freeSlots = nullptr;
+            adopted->lastFreeSlot = nullptr;
+        }
+
+        // Pools still sharing the adopted slab now allocate from ours, other starts over with a slab of its own, so
+        // that it can keep being used independently (e.g. by another thread) and ours stays the sole owner of its
+        // chunks once the adopted slab is gone
+        adopted->forward = slab;
+        other.slab.reset();
+    }
+};
+
+#endif
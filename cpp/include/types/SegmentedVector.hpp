@@ -0,0 +1,369 @@
+#ifndef SEGMENTED_VECTOR_HPP
+#define SEGMENTED_VECTOR_HPP
+
+#include "types/Allocation.hpp"
+#include "types/BoundsCheck.hpp"
+#include "types/Vector.hpp"
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Power of two number of elements filling about 16 KB
+template <typename T>
+constexpr size_t defaultSegmentSize() noexcept {
+    size_t size = 1;
+    while (size * 2 * sizeof(T) <= 16384) size *= 2;
+    return size;
+}
+
+/*
+ * Vector made of fixed size segments, which are never moved once allocated: growing allocates a new segment instead
+ * of relocating the elements, so that the cost of a push never depends on the size, and pointers to the elements
+ * stay valid until they are removed. Elements can be added and removed at both ends in constant time.
+ * Element i lives at position (start + i) of the directory of segments, in segment position / SegmentSize. The
+ * directory only holds pointers, it is the only thing copied as the vector grows, keeping room at its front for
+ * pushFront. The segments emptied at either end are freed, save one kept for reuse.
+ */
+template <typename T, size_t SegmentSize = defaultSegmentSize<T>(), typename BoundsCheck = DefaultBoundsCheck>
+class SegmentedVector {
+    static_assert(SegmentSize > 0 && (SegmentSize & (SegmentSize - 1)) == 0, "SegmentSize must be a power of two");
+    static_assert(alignof(T) <= DefaultAllocation::alignment, "SegmentedVector storage is only aligned for fundamental types");
+
+    static constexpr size_t Mask = SegmentSize - 1;
+    static constexpr size_t Shift = []() {
+        size_t shift = 0;
+        while ((size_t(1) << shift) < SegmentSize) shift++;
+        return shift;
+    }();
+
+    // Unused slots are null
+    Vector<T*> directory;
+    size_t start = 0;
+    size_t count = 0;
+    T* spare = nullptr;
+
+    T* allocateSegment() {
+        T* segment = spare;
+        spare = nullptr;
+        return segment != nullptr ? segment : static_cast<T*>(DefaultAllocation::allocate(SegmentSize * sizeof(T)));
+    }
+
+    void releaseSegment(size_t slot) noexcept {
+        if (spare == nullptr) {
+            spare = directory[slot];
+        } else {
+            DefaultAllocation::deallocate(directory[slot], SegmentSize * sizeof(T));
+        }
+        directory[slot] = nullptr;
+    }
+
+    T* address(size_t position) const noexcept {
+        // The position is valid, no need for the bounds check of the directory
+        return directory.begin()[position >> Shift] + (position & Mask);
+    }
+
+    // Slot for the element at position start + count, moving the used slots to the front when the ones before
+    // them are most of the directory, so that queues do not grow it forever
+    T* backSlot() {
+        size_t position = start + count;
+        size_t slot = position >> Shift;
+        if (slot == directory.size()) {
+            size_t unused = start >> Shift;
+            if (unused > 0 && unused >= directory.size() / 2) {
+                for (size_t i = unused; i < directory.size(); i++) {
+                    directory[i - unused] = directory[i];
+                    directory[i] = nullptr;
+                }
+                start -= unused << Shift;
+                position -= unused << Shift;
+                slot -= unused;
+            } else {
+                directory.push(nullptr);
+            }
+        }
+        if (directory[slot] == nullptr) directory[slot] = allocateSegment();
+        return directory[slot] + (position & Mask);
+    }
+
+    // Slot for the element at position start - 1, opening as many slots in front of the directory as it has
+    T* frontSlot() {
+        if (start == 0) {
+            size_t added = directory.empty() ? 1 : directory.size();
+            Vector<T*> larger;
+            larger.reserveExact(added + directory.size());
+            larger.resize(added, nullptr);
+            larger.append(directory.begin(), directory.end());
+            directory.swap(larger);
+            start = added << Shift;
+        }
+        size_t slot = (start - 1) >> Shift;
+        if (directory[slot] == nullptr) directory[slot] = allocateSegment();
+        return directory[slot] + ((start - 1) & Mask);
+    }
+
+    void releaseSegments() noexcept {
+        for (T* segment: directory) DefaultAllocation::deallocate(segment, SegmentSize * sizeof(T));
+        DefaultAllocation::deallocate(spare, SegmentSize * sizeof(T));
+        spare = nullptr;
+        directory.deallocate();
+        start = 0;
+    }
+
+    template <bool Const>
+    class Iterator {
+        friend class SegmentedVector;
+        friend class Iterator<!Const>;
+        typedef typename std::conditional<Const, const SegmentedVector, SegmentedVector>::type Container;
+        Container* container;
+        size_t index;
+
+        Iterator(Container* container, size_t index) noexcept : container(container), index(index) {}
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename std::conditional<Const, const T*, T*>::type pointer;
+        typedef typename std::conditional<Const, const T&, T&>::type reference;
+
+        Iterator() noexcept : container(nullptr), index(0) {}
+
+        // iterator converts to const_iterator
+        template <bool C = Const, typename = std::enable_if_t<!C>>
+        operator Iterator<true>() const noexcept { return Iterator<true>(container, index); }
+
+        reference operator*() const noexcept { return *container->address(container->start + index); }
+        pointer operator->() const noexcept { return container->address(container->start + index); }
+        reference operator[](difference_type offset) const noexcept { return *(*this + offset); }
+
+        Iterator& operator++() noexcept { index++; return *this; }
+        Iterator operator++(int) noexcept { Iterator old = *this; index++; return old; }
+        Iterator& operator--() noexcept { index--; return *this; }
+        Iterator operator--(int) noexcept { Iterator old = *this; index--; return old; }
+        Iterator& operator+=(difference_type offset) noexcept { index += offset; return *this; }
+        Iterator& operator-=(difference_type offset) noexcept { index -= offset; return *this; }
+        Iterator operator+(difference_type offset) const noexcept { return Iterator(container, index + offset); }
+        Iterator operator-(difference_type offset) const noexcept { return Iterator(container, index - offset); }
+        difference_type operator-(const Iterator& other) const noexcept { return (difference_type)index - (difference_type)other.index; }
+
+        bool operator==(const Iterator& other) const noexcept { return index == other.index; }
+        bool operator!=(const Iterator& other) const noexcept { return index != other.index; }
+        bool operator<(const Iterator& other) const noexcept { return index < other.index; }
+        bool operator>(const Iterator& other) const noexcept { return index > other.index; }
+        bool operator<=(const Iterator& other) const noexcept { return index <= other.index; }
+        bool operator>=(const Iterator& other) const noexcept { return index >= other.index; }
+    };
+public:
+    SegmentedVector() noexcept {}
+
+    SegmentedVector(size_t size, const T& value) {
+        for (size_t i = 0; i < size; i++) push(value);
+    }
+
+    SegmentedVector(std::initializer_list<T> list) {
+        for (const T& value: list) push(value);
+    }
+
+    SegmentedVector(const SegmentedVector& other) {
+        for (const T& value: other) push(value);
+    }
+
+    SegmentedVector(SegmentedVector&& other) noexcept {
+        swap(other);
+    }
+
+    ~SegmentedVector() {
+        clear();
+        releaseSegments();
+    }
+
+    SegmentedVector& operator=(const SegmentedVector& other) {
+        if (this == &other) return *this;
+        SegmentedVector copy(other);
+        swap(copy);
+        return *this;
+    }
+
+    SegmentedVector& operator=(SegmentedVector&& other) noexcept {
+        if (this == &other) return *this;
+        clear();
+        releaseSegments();
+        swap(other);
+        return *this;
+    }
+
+    T& operator[](size_t index) {
+        BoundsCheck::check(index, count);
+        return *address(start + index);
+    }
+
+    const T& operator[](size_t index) const {
+        BoundsCheck::check(index, count);
+        return *address(start + index);
+    }
+
+    T& at(size_t index) {
+        CheckedBounds::check(index, count);
+        return *address(start + index);
+    }
+
+    const T& at(size_t index) const {
+        CheckedBounds::check(index, count);
+        return *address(start + index);
+    }
+
+    bool operator==(const SegmentedVector& other) const {
+        if (size() != other.size()) return false;
+        for (size_t i = 0; i < count; i++) {
+            if ((*this)[i] != other[i]) return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const SegmentedVector& other) const {
+        return !((*this) == other);
+    }
+
+    typedef Iterator<false> iterator;
+    typedef Iterator<true> const_iterator;
+
+    iterator begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    iterator end() noexcept {
+        return iterator(this, count);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, count);
+    }
+
+    const_iterator cend() const noexcept {
+        return const_iterator(this, count);
+    }
+
+    bool empty() const noexcept {
+        return count == 0;
+    }
+
+    size_t size() const noexcept {
+        return count;
+    }
+
+    // Number of segments currently allocated, the spare one aside
+    size_t segments() const noexcept {
+        size_t allocated = 0;
+        for (T* segment: directory) allocated += segment != nullptr;
+        return allocated;
+    }
+
+    T& first() {
+        return (*this)[0];
+    }
+
+    const T& first() const {
+        return (*this)[0];
+    }
+
+    T& last() {
+        return (*this)[size() - 1];
+    }
+
+    const T& last() const {
+        return (*this)[size() - 1];
+    }
+
+    void push(const T& value) {
+        emplace(value);
+    }
+
+    void push(T&& value) {
+        emplace(std::move(value));
+    }
+
+    void pushFront(const T& value) {
+        emplaceFront(value);
+    }
+
+    void pushFront(T&& value) {
+        emplaceFront(std::move(value));
+    }
+
+    // Never moves the other elements, arguments may refer to them
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        T* slot = backSlot();
+        try {
+            ::new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            // The segment may have been allocated for this element, back growth would then overwrite its slot
+            size_t position = start + count;
+            if ((position & Mask) == 0 || count == 0) releaseSegment(position >> Shift);
+            throw;
+        }
+        count++;
+        return *slot;
+    }
+
+    template <typename... Args>
+    T& emplaceFront(Args&&... args) {
+        T* slot = frontSlot();
+        try {
+            ::new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            if ((start & Mask) == 0 || count == 0) releaseSegment((start - 1) >> Shift);
+            throw;
+        }
+        start--;
+        count++;
+        return *slot;
+    }
+
+    void pop() noexcept {
+        if (empty()) return;
+        size_t position = start + count - 1;
+        std::destroy_at(address(position));
+        count--;
+        if ((position & Mask) == 0 || count == 0) releaseSegment(position >> Shift);
+    }
+
+    void popFront() noexcept {
+        if (empty()) return;
+        std::destroy_at(address(start));
+        start++;
+        count--;
+        if ((start & Mask) == 0 || count == 0) releaseSegment((start - 1) >> Shift);
+    }
+
+    void resize(size_t newSize, const T& value = {}) {
+        while (size() > newSize) pop();
+        while (size() < newSize) push(value);
+    }
+
+    // Destroys the elements, keeping the directory
+    void clear() noexcept {
+        while (!empty()) pop();
+    }
+
+    void swap(SegmentedVector& other) noexcept {
+        directory.swap(other.directory);
+        std::swap(start, other.start);
+        std::swap(count, other.count);
+        std::swap(spare, other.spare);
+    }
+};
+
+#endif
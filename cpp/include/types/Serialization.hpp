@@ -0,0 +1,580 @@
+#ifndef SERIALIZATION_HPP
+#define SERIALIZATION_HPP
+
+#include "types/Array.hpp"
+#include "types/BoundsCheck.hpp"
+#include "types/Checksum.hpp"
+#include "types/Exceptions.hpp"
+#include "types/LinkedList.hpp"
+#include "types/Vector.hpp"
+
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+/*
+ * Binary serialization of Array, Vector and LinkedList, possibly nested, of trivially copyable elements.
+ * A file is a 64 bytes header followed by the payload:
+ *   magic "ALGOSER\0", version (u16), nesting depth (u16), element category (u32), element size (u32), zeros (u32),
+ *   element count (u64), payload size (u64), checksum (u32), zeros
+ * The checksum is the CRC-32C of the payload followed by the header, whose checksum field is zero while computing it.
+ * The payload of a sequence of elements is their raw bytes. The payload of a sequence of sequences is an offset
+ * table of count + 1 u64 giving where each sequence starts (from the start of the payload, the last one being its
+ * end), followed by the sequences, each one being its element count (u64) and 8 bytes of padding before its own
+ * payload. Payloads start on 16 bytes boundaries, so that elements can be used right from a mapping of the file.
+ * All integers are little endian, and so are elements: the format is only implemented on little endian machines.
+ * The container types are not recorded, a Vector can be read back as a LinkedList or an Array of the same size.
+ *
+ *   serialize(values, "values.bin");       // a single writev for a Vector or an Array
+ *   deserialize("values.bin", values);     // a single read
+ *   SerializedView<Vector<int>> view("values.bin");   // no read at all, elements are paged in from the file
+ * Throws IOException when a file cannot be written or read, or does not hold the expected elements. Counts and
+ * offsets are checked against the payload before being used, so that even a file that is not verified against its
+ * checksum never leads to reading outside of it.
+ */
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "Serialization.hpp writes elements as they are in memory, which is only little endian on little endian machines"
+#endif
+
+// Which kind of elements a file holds, along with their size
+enum class SerialCategory : uint32_t {
+    Boolean = 1,
+    Character = 2,
+    Signed = 3,
+    Unsigned = 4,
+    Floating = 5,
+    // Any other trivially copyable type
+    Raw = 6
+};
+
+// Specialized by the containers that can be serialized
+template <typename C>
+struct SerialSequence : std::false_type {};
+
+template <typename T, size_t S, typename BoundsCheck>
+struct SerialSequence<Array<T, S, BoundsCheck>> : std::true_type {
+    typedef T value_type;
+    static constexpr bool contiguous = true;
+
+    static const T* data(const Array<T, S, BoundsCheck>& array) noexcept {
+        return array.begin();
+    }
+
+    static T* data(Array<T, S, BoundsCheck>& array) noexcept {
+        return array.begin();
+    }
+
+    // Makes room for count elements, the size of an Array cannot change
+    static void prepare(Array<T, S, BoundsCheck>&, size_t count) {
+        if (count != S) throw IOException("cannot read " + std::to_string(count) + " elements into an Array of " + std::to_string(S));
+    }
+};
+
+template <typename T, typename BoundsCheck, typename Allocation, typename Growth>
+struct SerialSequence<Vector<T, BoundsCheck, Allocation, Growth>> : std::true_type {
+    typedef T value_type;
+    static constexpr bool contiguous = true;
+
+    static const T* data(const Vector<T, BoundsCheck, Allocation, Growth>& vect) noexcept {
+        return vect.begin();
+    }
+
+    static T* data(Vector<T, BoundsCheck, Allocation, Growth>& vect) noexcept {
+        return vect.begin();
+    }
+
+    static void prepare(Vector<T, BoundsCheck, Allocation, Growth>& vect, size_t count) {
+        vect.clear();
+        vect.reserveExact(count);
+        vect.resize(count);
+    }
+};
+
+template <typename T, typename Allocator>
+struct SerialSequence<LinkedList<T, Allocator>> : std::true_type {
+    typedef T value_type;
+    static constexpr bool contiguous = false;
+
+    static void prepare(LinkedList<T, Allocator>& list, size_t count) {
+        list.clear();
+        for (size_t i = 0; i < count; i++) list.emplace();
+    }
+};
+
+// Elements of the innermost sequences, and how deep they are nested
+template <typename T, typename = void>
+struct SerialElement {
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable elements can be serialized");
+    static_assert(alignof(T) <= 16, "Serialized elements are aligned on 16 bytes at most");
+    typedef T type;
+    static constexpr uint16_t depth = 0;
+
+    static constexpr SerialCategory category() noexcept {
+        if (std::is_same<T, bool>::value) return SerialCategory::Boolean;
+        if (std::is_same<T, char>::value || std::is_same<T, char16_t>::value || std::is_same<T, char32_t>::value || std::is_same<T, wchar_t>::value) return SerialCategory::Character;
+        if (std::is_integral<T>::value && std::is_signed<T>::value) return SerialCategory::Signed;
+        if (std::is_integral<T>::value || std::is_enum<T>::value) return SerialCategory::Unsigned;
+        if (std::is_floating_point<T>::value) return SerialCategory::Floating;
+        return SerialCategory::Raw;
+    }
+};
+
+template <typename C>
+struct SerialElement<C, std::enable_if_t<SerialSequence<C>::value>> {
+    typedef typename SerialElement<typename SerialSequence<C>::value_type>::type type;
+    static constexpr uint16_t depth = SerialElement<typename SerialSequence<C>::value_type>::depth + 1;
+};
+
+// Raw access to the payload of a sequence, made of bytes bytes. Spans of sequences hand out spans of their elements.
+template <typename C>
+class SerialSpan {
+    typedef typename SerialSequence<C>::value_type T;
+    static constexpr bool isLeaf = !SerialSequence<T>::value;
+
+    [[noreturn]] ALGORITHMIC_COLD static void corrupted() {
+        throw IOException("serialized payload is corrupted");
+    }
+
+    static uint64_t word(const unsigned char* memory) noexcept {
+        uint64_t value;
+        std::memcpy(&value, memory, sizeof(uint64_t));
+        return value;
+    }
+
+    // Size of the offset table of a sequence of count sequences
+    static size_t tableSize(size_t count) noexcept {
+        size_t size = (count + 1) * sizeof(uint64_t);
+        return (size + 15) / 16 * 16;
+    }
+protected:
+    const unsigned char* payload = nullptr;
+    size_t count = 0;
+    size_t bytes = 0;
+
+    // Throws IOException unless count elements fit in bytes
+    void check() const {
+        if constexpr (isLeaf) {
+            if (count > bytes / sizeof(T)) corrupted();
+        } else {
+            if (count >= bytes / sizeof(uint64_t) || tableSize(count) > bytes) corrupted();
+        }
+    }
+public:
+    SerialSpan() noexcept {}
+
+    // Throws IOException if count elements cannot fit in bytes
+    SerialSpan(const unsigned char* payload, size_t count, size_t bytes) : payload(payload), count(count), bytes(bytes) {
+        check();
+    }
+
+    size_t size() const noexcept {
+        return count;
+    }
+
+    bool empty() const noexcept {
+        return count == 0;
+    }
+
+    // Either an element, or the span of the sequence at index
+    decltype(auto) operator[](size_t index) const {
+        CheckedBounds::check(index, count);
+        if constexpr (isLeaf) {
+            return reinterpret_cast<const T*>(payload)[index];
+        } else {
+            // The sequence spans from its offset to the next one, starting with its count and padding
+            uint64_t offset = word(payload + index * sizeof(uint64_t));
+            uint64_t next = word(payload + (index + 1) * sizeof(uint64_t));
+            if (offset < tableSize(count) || offset % 16 != 0 || next > bytes || offset > next || next - offset < 16) corrupted();
+            return SerialSpan<T>(payload + offset + 16, word(payload + offset), next - offset - 16);
+        }
+    }
+
+    // Only for elements, not sequences
+    const T* begin() const noexcept {
+        static_assert(isLeaf, "Spans of sequences are only indexed");
+        return reinterpret_cast<const T*>(payload);
+    }
+
+    const T* end() const noexcept {
+        return begin() + count;
+    }
+};
+
+// Layout of the files, and the pieces the functions below are made of
+struct SerialFormat {
+    static constexpr char Magic[8] = {'A', 'L', 'G', 'O', 'S', 'E', 'R', 0};
+    static constexpr uint16_t Version = 2;
+    static constexpr size_t HeaderSize = 64;
+    static constexpr size_t PayloadAlignment = 16;
+    static constexpr unsigned char padding[PayloadAlignment] = {};
+
+    struct Header {
+        char magic[8];
+        uint16_t version;
+        uint16_t depth;
+        uint32_t category;
+        uint32_t elementSize;
+        uint32_t reserved;
+        uint64_t count;
+        uint64_t payloadSize;
+        uint32_t checksum;
+        unsigned char zeros[HeaderSize - 44];
+    };
+    static_assert(sizeof(Header) == HeaderSize, "The header takes 64 bytes");
+
+    static constexpr size_t aligned(size_t size) noexcept {
+        return (size + PayloadAlignment - 1) / PayloadAlignment * PayloadAlignment;
+    }
+
+    template <typename C>
+    static Header header(size_t count, size_t payloadSize, uint32_t checksum) noexcept {
+        typedef SerialElement<C> Element;
+        Header header = {};
+        std::memcpy(header.magic, Magic, sizeof(Magic));
+        header.version = Version;
+        header.depth = Element::depth;
+        header.category = static_cast<uint32_t>(SerialElement<typename Element::type>::category());
+        header.elementSize = sizeof(typename Element::type);
+        header.count = count;
+        header.payloadSize = payloadSize;
+        header.checksum = checksum;
+        return header;
+    }
+
+    // Covers the header as well, so that a corrupted count or size is caught like a corrupted element
+    static uint32_t checksum(Header header, uint32_t payloadChecksum) noexcept {
+        header.checksum = 0;
+        return crc32c(&header, HeaderSize, payloadChecksum);
+    }
+
+    [[noreturn]] ALGORITHMIC_COLD static void fail(const char* operation, const std::string& path) {
+        throw IOException(std::string(operation) + " " + path + ": " + std::strerror(errno));
+    }
+
+    // Checks that header describes C, returns the payload size
+    template <typename C>
+    static size_t validate(const Header& header, const std::string& path, size_t fileSize) {
+        Header expected = SerialFormat::header<C>(header.count, header.payloadSize, header.checksum);
+        if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version) {
+            throw IOException(path + " is not a serialized container");
+        }
+        if (header.depth != expected.depth || header.category != expected.category || header.elementSize != expected.elementSize) {
+            throw IOException(path + " holds other elements");
+        }
+        if (header.payloadSize > fileSize - HeaderSize) throw IOException(path + " is truncated");
+        return header.payloadSize;
+    }
+
+    template <typename C>
+    static size_t payloadSize(const C& container) {
+        typedef typename SerialSequence<C>::value_type T;
+        if constexpr (!SerialSequence<T>::value) {
+            return container.size() * sizeof(T);
+        } else {
+            size_t size = aligned((container.size() + 1) * sizeof(uint64_t));
+            for (const T& element: container) size += PayloadAlignment + aligned(payloadSize(element));
+            return size;
+        }
+    }
+
+    /*
+     * Gathers the pieces of a payload as an iovec list, computing its checksum along the way, and writes them all
+     * with as few writev calls as IOV_MAX allows. The pieces which are not in memory already (offset tables, linked
+     * list elements) are kept in buffers until written.
+     */
+    class Writer {
+        Vector<iovec> pieces;
+        Vector<std::unique_ptr<unsigned char[]>> buffers;
+        size_t size = 0;
+        uint32_t checksum = 0;
+
+        void add(const void* data, size_t bytes) {
+            if (bytes == 0) return;
+            pieces.push(iovec{const_cast<void*>(data), bytes});
+            checksum = crc32c(data, bytes, checksum);
+            size += bytes;
+        }
+
+        unsigned char* buffer(size_t bytes) {
+            buffers.push(std::unique_ptr<unsigned char[]>(new unsigned char[bytes]));
+            return buffers.last().get();
+        }
+
+        void pad() {
+            add(padding, aligned(size) - size);
+        }
+    public:
+        template <typename C>
+        void append(const C& container) {
+            typedef SerialSequence<C> Sequence;
+            typedef typename Sequence::value_type T;
+            if constexpr (!SerialSequence<T>::value) {
+                if constexpr (Sequence::contiguous) {
+                    add(Sequence::data(container), container.size() * sizeof(T));
+                } else {
+                    unsigned char* elements = buffer(container.size() * sizeof(T));
+                    size_t offset = 0;
+                    for (const T& element: container) {
+                        std::memcpy(elements + offset, static_cast<const void*>(&element), sizeof(T));
+                        offset += sizeof(T);
+                    }
+                    add(elements, offset);
+                }
+            } else {
+                // Offset table, then a count and padding in front of each element
+                size_t count = container.size();
+                size_t tableSize = aligned((count + 1) * sizeof(uint64_t));
+                unsigned char* table = buffer(tableSize + count * PayloadAlignment);
+                std::memset(table, 0, tableSize + count * PayloadAlignment);
+                uint64_t offset = tableSize;
+                size_t index = 0;
+                for (const T& element: container) {
+                    std::memcpy(table + index * sizeof(uint64_t), &offset, sizeof(uint64_t));
+                    uint64_t elementCount = element.size();
+                    std::memcpy(table + tableSize + index * PayloadAlignment, &elementCount, sizeof(uint64_t));
+                    offset += PayloadAlignment + aligned(SerialFormat::payloadSize(element));
+                    index++;
+                }
+                std::memcpy(table + count * sizeof(uint64_t), &offset, sizeof(uint64_t));
+
+                size_t start = size;
+                add(table, tableSize);
+                index = 0;
+                for (const T& element: container) {
+                    add(table + tableSize + index * PayloadAlignment, PayloadAlignment);
+                    append(element);
+                    // Padding relative to the start of the payload, which is itself aligned
+                    add(padding, aligned(size - start) - (size - start));
+                    index++;
+                }
+            }
+        }
+
+        size_t payloadSize() const noexcept {
+            return size;
+        }
+
+        uint32_t payloadChecksum() const noexcept {
+            return checksum;
+        }
+
+        // Writes header then the payload, retrying after partial writes
+        void write(int file, const Header& header, const std::string& path) {
+            Vector<iovec> all;
+            all.reserveExact(pieces.size() + 1);
+            all.push(iovec{const_cast<Header*>(&header), HeaderSize});
+            all.append(pieces.begin(), pieces.end());
+
+            size_t next = 0;
+            while (next < all.size()) {
+                size_t batch = all.size() - next < IOV_MAX ? all.size() - next : IOV_MAX;
+                ssize_t written = ::writev(file, all.begin() + next, (int)batch);
+                if (written < 0) {
+                    if (errno == EINTR) continue;
+                    fail("writev", path);
+                }
+                // Skips the pieces fully written, trims the one partially written
+                size_t remaining = written;
+                while (next < all.size() && remaining >= all[next].iov_len) {
+                    remaining -= all[next].iov_len;
+                    next++;
+                }
+                if (remaining > 0) {
+                    all[next].iov_base = static_cast<char*>(all[next].iov_base) + remaining;
+                    all[next].iov_len -= remaining;
+                }
+            }
+        }
+    };
+
+    static void readFully(int file, void* destination, size_t bytes, const std::string& path) {
+        char* position = static_cast<char*>(destination);
+        while (bytes > 0) {
+            ssize_t done = ::read(file, position, bytes);
+            if (done < 0) {
+                if (errno == EINTR) continue;
+                fail("read", path);
+            }
+            if (done == 0) throw IOException(path + " is truncated");
+            position += done;
+            bytes -= done;
+        }
+    }
+
+    // Fills container from the span of its serialized payload
+    template <typename C>
+    static void read(C& container, const SerialSpan<C>& span) {
+        typedef SerialSequence<C> Sequence;
+        typedef typename Sequence::value_type T;
+        Sequence::prepare(container, span.size());
+        if constexpr (!SerialSequence<T>::value) {
+            if constexpr (Sequence::contiguous) {
+                if (span.size() > 0) std::memcpy(static_cast<void*>(Sequence::data(container)), span.begin(), span.size() * sizeof(T));
+            } else {
+                const T* element = span.begin();
+                for (T& value: container) std::memcpy(static_cast<void*>(&value), element++, sizeof(T));
+            }
+        } else {
+            size_t index = 0;
+            for (T& value: container) read(value, span[index++]);
+        }
+    }
+
+    // Closes the file when going out of scope
+    struct File {
+        int descriptor;
+
+        File(const std::string& path, int flags) : descriptor(::open(path.c_str(), flags | O_CLOEXEC, 0644)) {
+            if (descriptor < 0) fail("open", path);
+        }
+
+        // Creates a file named after pattern, whose trailing XXXXXX are replaced to make the name unique
+        File(std::string& pattern) : descriptor(::mkostemp(&pattern[0], O_CLOEXEC)) {
+            if (descriptor < 0) fail("mkostemp", pattern);
+        }
+
+        ~File() {
+            ::close(descriptor);
+        }
+
+        File(const File&) = delete;
+        File& operator=(const File&) = delete;
+    };
+
+    static size_t fileSize(const File& file, const std::string& path) {
+        struct stat status;
+        if (fstat(file.descriptor, &status) != 0) fail("fstat", path);
+        if ((size_t)status.st_size < HeaderSize) throw IOException(path + " is not a serialized container");
+        return status.st_size;
+    }
+
+    // Makes the entries of the directory holding path, as renamed, durable
+    static void syncDirectory(const std::string& path) {
+        size_t separator = path.rfind('/');
+        std::string directory = separator == std::string::npos ? "." : separator == 0 ? "/" : path.substr(0, separator);
+        File file(directory, O_RDONLY | O_DIRECTORY);
+        if (::fsync(file.descriptor) != 0) fail("fsync", directory);
+    }
+};
+
+/*
+ * Writes container to path. The file is written under a unique name next to it, flushed to the disk and then
+ * renamed, so that even after a crash path holds either the previous or the new content, never a partial one.
+ * Concurrent writers to a same path do not clobber each other's file, the last one renamed wins.
+ */
+template <typename C>
+void serialize(const C& container, const std::string& path) {
+    static_assert(SerialSequence<C>::value, "Only Array, Vector and LinkedList can be serialized");
+    SerialFormat::Writer writer;
+    writer.append(container);
+    SerialFormat::Header header = SerialFormat::header<C>(container.size(), writer.payloadSize(), 0);
+    header.checksum = SerialFormat::checksum(header, writer.payloadChecksum());
+
+    std::string temporary = path + ".XXXXXX";
+    SerialFormat::File file(temporary);
+    try {
+        // mkostemp only lets the owner read it
+        if (::fchmod(file.descriptor, 0644) != 0) SerialFormat::fail("fchmod", temporary);
+        writer.write(file.descriptor, header, temporary);
+        if (::fsync(file.descriptor) != 0) SerialFormat::fail("fsync", temporary);
+    } catch (...) {
+        std::remove(temporary.c_str());
+        throw;
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        SerialFormat::fail("rename", path);
+    }
+    SerialFormat::syncDirectory(path);
+}
+
+// Replaces the content of container with the one serialized at path, checking its checksum
+template <typename C>
+void deserialize(const std::string& path, C& container) {
+    static_assert(SerialSequence<C>::value, "Only Array, Vector and LinkedList can be deserialized");
+    typedef SerialSequence<C> Sequence;
+    typedef typename Sequence::value_type T;
+
+    SerialFormat::File file(path, O_RDONLY);
+    size_t fileSize = SerialFormat::fileSize(file, path);
+    SerialFormat::Header header;
+    SerialFormat::readFully(file.descriptor, &header, sizeof(header), path);
+    size_t payloadSize = SerialFormat::validate<C>(header, path, fileSize);
+
+    if constexpr (!SerialSequence<T>::value && Sequence::contiguous) {
+        // Straight into the elements
+        if (header.count > payloadSize / sizeof(T) || payloadSize != header.count * sizeof(T)) throw IOException(path + " is corrupted");
+        C result;
+        Sequence::prepare(result, header.count);
+        SerialFormat::readFully(file.descriptor, Sequence::data(result), payloadSize, path);
+        uint32_t checksum = SerialFormat::checksum(header, crc32c(Sequence::data(result), payloadSize));
+        if (checksum != header.checksum) throw IOException(path + " is corrupted");
+        container = std::move(result);
+    } else {
+        std::unique_ptr<unsigned char[]> payload(new unsigned char[payloadSize + SerialFormat::PayloadAlignment]);
+        // new[] only aligns for fundamental types, elements are read in place from the span
+        unsigned char* aligned = payload.get() + (SerialFormat::PayloadAlignment - reinterpret_cast<uintptr_t>(payload.get()) % SerialFormat::PayloadAlignment) % SerialFormat::PayloadAlignment;
+        SerialFormat::readFully(file.descriptor, aligned, payloadSize, path);
+        if (SerialFormat::checksum(header, crc32c(aligned, payloadSize)) != header.checksum) throw IOException(path + " is corrupted");
+        SerialFormat::read(container, SerialSpan<C>(aligned, header.count, payloadSize));
+    }
+}
+
+/*
+ * Elements serialized at path, read straight from a read only mapping of the file: nothing is copied, and pages
+ * are only read from the disk when first accessed. Unless verify is false, the checksum is checked right away,
+ * which reads the whole file. Either way, counts and offsets are checked as sequences are accessed.
+ */
+template <typename C>
+class SerializedView : public SerialSpan<C> {
+    void* mapping = nullptr;
+    size_t mappedBytes = 0;
+public:
+    explicit SerializedView(const std::string& path, bool verify = true) {
+        static_assert(SerialSequence<C>::value, "Only Array, Vector and LinkedList can be deserialized");
+        SerialFormat::File file(path, O_RDONLY);
+        size_t fileSize = SerialFormat::fileSize(file, path);
+        void* memory = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, file.descriptor, 0);
+        if (memory == MAP_FAILED) SerialFormat::fail("mmap", path);
+        mapping = memory;
+        mappedBytes = fileSize;
+
+        try {
+            const SerialFormat::Header& header = *static_cast<const SerialFormat::Header*>(mapping);
+            size_t payloadSize = SerialFormat::validate<C>(header, path, fileSize);
+            const unsigned char* payload = static_cast<const unsigned char*>(mapping) + SerialFormat::HeaderSize;
+            if (verify && SerialFormat::checksum(header, crc32c(payload, payloadSize)) != header.checksum) {
+                throw IOException(path + " is corrupted");
+            }
+            this->payload = payload;
+            this->count = header.count;
+            this->bytes = payloadSize;
+            this->check();
+        } catch (...) {
+            munmap(mapping, mappedBytes);
+            throw;
+        }
+    }
+
+    SerializedView(const SerializedView&) = delete;
+    SerializedView& operator=(const SerializedView&) = delete;
+
+    ~SerializedView() {
+        munmap(mapping, mappedBytes);
+    }
+};
+
+#endif
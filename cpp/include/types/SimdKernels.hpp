@@ -0,0 +1,325 @@
+#ifndef SIMD_KERNELS_HPP
+#define SIMD_KERNELS_HPP
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__GNUC__)
+#define ALGORITHMIC_INLINE __attribute__((always_inline)) inline
+#define ALGORITHMIC_VECTOR_EXTENSIONS
+#else
+#define ALGORITHMIC_INLINE inline
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ALGORITHMIC_X86_DISPATCH
+#define ALGORITHMIC_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+/*
+ * Element-wise kernels over arithmetic values, written once against fixed width vectors (GCC/Clang vector
+ * extensions) and instantiated for 128, 256 and 512 bit vectors. On x86 the widest set supported by the running CPU
+ * is picked at runtime: SSE2 (128), AVX2 (256) or AVX-512 (512). Other GCC/Clang targets use 128 bit vectors as
+ * their own SIMD unit allows, and other compilers the plain scalar loops.
+ * Floating point reductions add values in a different order than a sequential loop, rounding may differ slightly.
+ */
+
+// Vector size in bytes, Scalar disables vectorization
+enum class SimdWidth : size_t {
+    Scalar = 0,
+    Bits128 = 16,
+    Bits256 = 32,
+    Bits512 = 64
+};
+
+// Widest vectors the running CPU supports, detected once
+inline SimdWidth detectedSimdWidth() noexcept {
+#if defined(ALGORITHMIC_X86_DISPATCH)
+    static const SimdWidth width = []() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return SimdWidth::Bits512;
+        if (__builtin_cpu_supports("avx2")) return SimdWidth::Bits256;
+        return SimdWidth::Bits128;
+    }();
+    return width;
+#elif defined(ALGORITHMIC_VECTOR_EXTENSIONS)
+    return SimdWidth::Bits128;
+#else
+    return SimdWidth::Scalar;
+#endif
+}
+
+#if defined(ALGORITHMIC_VECTOR_EXTENSIONS)
+template <typename T, size_t Bytes>
+struct SimdPack {
+    typedef T Type __attribute__((vector_size(Bytes)));
+    typedef decltype(Type() == Type()) Mask;
+    // Overflowing signed lanes is undefined, sums wrap around in their unsigned counterpart instead
+    typedef typename std::conditional<std::is_integral<T>::value, std::make_unsigned<T>, std::common_type<T>>::type::type WrappingLane;
+    typedef WrappingLane Wrapping __attribute__((vector_size(Bytes)));
+    static constexpr size_t Width = Bytes / sizeof(T);
+};
+#endif
+
+template <typename T>
+class SimdKernels {
+    static_assert(std::is_arithmetic<T>::value, "SIMD kernels only apply to arithmetic elements");
+
+    // Vector extensions support neither bool nor long double lanes
+    static constexpr bool isVectorizable = !std::is_same<T, bool>::value && !std::is_same<T, long double>::value;
+
+    template <size_t Bytes>
+    static constexpr bool vectorized() noexcept {
+        return Bytes > 0 && isVectorizable;
+    }
+
+    /*
+     * Every kernel provides run<Bytes>(...), processing vectors of Bytes bytes before finishing with scalar code.
+     * They are always inlined, into the dispatch functions below compiled for the matching instruction set.
+     */
+    struct Sum {
+        template <size_t Bytes>
+        static ALGORITHMIC_INLINE T run(const T* values, size_t size) {
+            T result = 0;
+            size_t i = 0;
+#if defined(ALGORITHMIC_VECTOR_EXTENSIONS)
+            if constexpr (vectorized<Bytes>()) {
+                typedef SimdPack<T, Bytes> Pack;
+                // Two accumulators hide the latency of the additions
+                typename Pack::Wrapping first = {};
+                typename Pack::Wrapping second = {};
+                for (size_t end = size - size % (2 * Pack::Width); i < end; i += 2 * Pack::Width) {
+                    typename Pack::Wrapping a, b;
+                    std::memcpy(&a, values + i, Bytes);
+                    std::memcpy(&b, values + i + Pack::Width, Bytes);
+                    first += a;
+                    second += b;
+                }
+                first += second;
+                for (size_t lane = 0; lane < Pack::Width; lane++) result += static_cast<T>(first[lane]);
+            }
+#endif
+            for (; i < size; i++) result += values[i];
+            return result;
+        }
+    };
+
+    template <bool Maximum>
+    struct Extremum {
+        template <size_t Bytes>
+        static ALGORITHMIC_INLINE T run(const T* values, size_t size) {
+            T result = values[0];
+            size_t i = 1;
+#if defined(ALGORITHMIC_VECTOR_EXTENSIONS)
+            if constexpr (vectorized<Bytes>()) {
+                typedef SimdPack<T, Bytes> Pack;
+                if (size >= Pack::Width) {
+                    typename Pack::Type best;
+                    std::memcpy(&best, values, Bytes);
+                    for (i = Pack::Width; i < size - size % Pack::Width; i += Pack::Width) {
+                        typename Pack::Type a;
+                        std::memcpy(&a, values + i, Bytes);
+                        if constexpr (Maximum) best = a > best ? a : best; else best = a < best ? a : best;
+                    }
+                    for (size_t lane = 0; lane < Pack::Width; lane++) result = better(best[lane], result);
+                }
+            }
+#endif
+            for (; i < size; i++) result = better(values[i], result);
+            return result;
+        }
+
+        static ALGORITHMIC_INLINE T better(T a, T b) {
+            if constexpr (Maximum) return a > b ? a : b; else return a < b ? a : b;
+        }
+    };
+
+    struct Dot {
+        template <size_t Bytes>
+        static ALGORITHMIC_INLINE T run(const T* a, const T* b, size_t size) {
+            T result = 0;
+            size_t i = 0;
+#if defined(ALGORITHMIC_VECTOR_EXTENSIONS)
+            if constexpr (vectorized<Bytes>()) {
+                typedef SimdPack<T, Bytes> Pack;
+                typename Pack::Wrapping first = {};
+                typename Pack::Wrapping second = {};
+                for (size_t end = size - size % (2 * Pack::Width); i < end; i += 2 * Pack::Width) {
+                    typename Pack::Wrapping x, y, z, w;
+                    std::memcpy(&x, a + i, Bytes);
+                    std::memcpy(&y, b + i, Bytes);
+                    std::memcpy(&z, a + i + Pack::Width, Bytes);
+                    std::memcpy(&w, b + i + Pack::Width, Bytes);
+                    first += x * y;
+                    second += z * w;
+                }
+                first += second;
+                for (size_t lane = 0; lane < Pack::Width; lane++) result += static_cast<T>(first[lane]);
+            }
+#endif
+            for (; i < size; i++) result += a[i] * b[i];
+            return result;
+        }
+    };
+
+    struct Axpy {
+        template <size_t Bytes>
+        static ALGORITHMIC_INLINE void run(T alpha, const T* x, T* y, size_t size) {
+            size_t i = 0;
+#if defined(ALGORITHMIC_VECTOR_EXTENSIONS)
+            if constexpr (vectorized<Bytes>()) {
+                typedef SimdPack<T, Bytes> Pack;
+                typename Pack::Wrapping alphas = {};
+                alphas += static_cast<typename Pack::WrappingLane>(alpha);
+                for (size_t end = size - size % Pack::Width; i < end; i += Pack::Width) {
+                    typename Pack::Wrapping a, b;
+                    std::memcpy(&a, x + i, Bytes);
+                    std::memcpy(&b, y + i, Bytes);
+                    b += alphas * a;
+                    std::memcpy(y + i, &b, Bytes);
+                }
+            }
+#endif
+            for (; i < size; i++) y[i] += alpha * x[i];
+        }
+    };
+
+    struct Find {
+        template <size_t Bytes>
+        static ALGORITHMIC_INLINE size_t run(const T* values, size_t size, T value) {
+            size_t i = 0;
+#if defined(ALGORITHMIC_VECTOR_EXTENSIONS)
+            if constexpr (vectorized<Bytes>()) {
+                typedef SimdPack<T, Bytes> Pack;
+                typename Pack::Type target = {};
+                target += value;
+                for (size_t end = size - size % Pack::Width; i < end; i += Pack::Width) {
+                    typename Pack::Type a;
+                    std::memcpy(&a, values + i, Bytes);
+                    typename Pack::Mask equal = a == target;
+                    // Any lane set, then look for the first one
+                    uint64_t words[Bytes / sizeof(uint64_t)];
+                    std::memcpy(words, &equal, Bytes);
+                    uint64_t any = 0;
+                    for (uint64_t word: words) any |= word;
+                    if (any != 0) break;
+                }
+            }
+#endif
+            for (; i < size; i++) {
+                if (values[i] == value) return i;
+            }
+            return size;
+        }
+    };
+
+    struct Count {
+        template <size_t Bytes>
+        static ALGORITHMIC_INLINE size_t run(const T* values, size_t size, T value) {
+            size_t result = 0;
+            size_t i = 0;
+#if defined(ALGORITHMIC_VECTOR_EXTENSIONS)
+            if constexpr (vectorized<Bytes>()) {
+                typedef SimdPack<T, Bytes> Pack;
+                typename Pack::Type target = {};
+                target += value;
+                // Matching lanes are -1, the per lane counters are flushed before 8 bit ones could overflow
+                typename Pack::Mask counters = {};
+                size_t pending = 0;
+                for (size_t end = size - size % Pack::Width; i < end; i += Pack::Width) {
+                    typename Pack::Type a;
+                    std::memcpy(&a, values + i, Bytes);
+                    counters -= a == target;
+                    if (++pending == 64) {
+                        for (size_t lane = 0; lane < Pack::Width; lane++) result += (size_t)counters[lane];
+                        counters = typename Pack::Mask{};
+                        pending = 0;
+                    }
+                }
+                for (size_t lane = 0; lane < Pack::Width; lane++) result += (size_t)counters[lane];
+            }
+#endif
+            for (; i < size; i++) result += values[i] == value;
+            return result;
+        }
+    };
+
+    // Leaves vectorization to the compiler, the loop being compiled once per instruction set
+    struct Evaluate {
+        template <size_t Bytes, typename Expression>
+        static ALGORITHMIC_INLINE void run(T* destination, const Expression* expression, size_t size) {
+            for (size_t i = 0; i < size; i++) destination[i] = (*expression)[i];
+        }
+    };
+
+#if defined(ALGORITHMIC_X86_DISPATCH)
+    template <typename Kernel, typename... Args>
+    ALGORITHMIC_TARGET("avx2") static auto runBits256(Args... args) {
+        return Kernel::template run<32>(args...);
+    }
+
+    template <typename Kernel, typename... Args>
+    ALGORITHMIC_TARGET("avx512f,avx512bw") static auto runBits512(Args... args) {
+        return Kernel::template run<64>(args...);
+    }
+#endif
+
+    // Never runs wider vectors than the CPU supports, whatever width asks for
+    template <typename Kernel, typename... Args>
+    static auto run(SimdWidth width, Args... args) {
+        if (width > detectedSimdWidth()) width = detectedSimdWidth();
+        switch (width) {
+#if defined(ALGORITHMIC_X86_DISPATCH)
+            case SimdWidth::Bits512:
+                return runBits512<Kernel>(args...);
+            case SimdWidth::Bits256:
+                return runBits256<Kernel>(args...);
+#endif
+            case SimdWidth::Bits128:
+                return Kernel::template run<16>(args...);
+            default:
+                return Kernel::template run<0>(args...);
+        }
+    }
+public:
+    static T sum(const T* values, size_t size, SimdWidth width = detectedSimdWidth()) {
+        return run<Sum>(width, values, size);
+    }
+
+    // size must not be 0. The result is unspecified if values contain NaNs.
+    static T min(const T* values, size_t size, SimdWidth width = detectedSimdWidth()) {
+        return run<Extremum<false>>(width, values, size);
+    }
+
+    static T max(const T* values, size_t size, SimdWidth width = detectedSimdWidth()) {
+        return run<Extremum<true>>(width, values, size);
+    }
+
+    static T dot(const T* a, const T* b, size_t size, SimdWidth width = detectedSimdWidth()) {
+        return run<Dot>(width, a, b, size);
+    }
+
+    // y[i] += alpha * x[i]
+    static void axpy(T alpha, const T* x, T* y, size_t size, SimdWidth width = detectedSimdWidth()) {
+        run<Axpy>(width, alpha, x, y, size);
+    }
+
+    // Index of the first value equal to value, size if there is none
+    static size_t find(const T* values, size_t size, T value, SimdWidth width = detectedSimdWidth()) {
+        return run<Find>(width, values, size, value);
+    }
+
+    static size_t count(const T* values, size_t size, T value, SimdWidth width = detectedSimdWidth()) {
+        return run<Count>(width, values, size, value);
+    }
+
+    // destination[i] = expression[i], destination may be one of the operands of expression
+    template <typename Expression>
+    static void evaluate(T* destination, const Expression& expression, size_t size, SimdWidth width = detectedSimdWidth()) {
+        run<Evaluate>(width, destination, &expression, size);
+    }
+};
+
+#endif
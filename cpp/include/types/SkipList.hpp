@@ -0,0 +1,270 @@
+#ifndef SKIP_LIST_HPP
+#define SKIP_LIST_HPP
+
+#include <cstdint>
+#include <cstdlib>
+#include "types/Exceptions.hpp"
+#include <new>
+#include <utility>
+
+// Entry of a SkipList. Its links, one per level it appears in, are allocated right after it.
+template <typename K, typename V>
+struct SkipListNode {
+    const K key;
+    V value;
+    size_t height;
+    SkipListNode<K, V>** next;
+
+    SkipListNode(const K& key, const V& value, size_t height, SkipListNode<K, V>** next)
+        : key(key), value(value), height(height), next(next) {}
+};
+
+/*
+ * Ordered map with O(log n) expected search, insertion and removal (Pugh, 1990).
+ * Its bottom level is a sorted singly linked list of every entry, like LinkedList, and each upper level links a
+ * random quarter of the entries of the level below it, letting searches skip over most of the list.
+ * Keys are compared with operator<.
+ */
+template <typename K, typename V>
+class SkipList {
+public:
+    static constexpr size_t MaxHeight = 32;
+private:
+    typedef SkipListNode<K, V> Node;
+
+    Node* heads[MaxHeight];
+    size_t height;
+    size_t count;
+    uint64_t seed;
+
+    static Node* createNode(const K& key, const V& value, size_t height) {
+        void* memory = ::operator new(sizeof(Node) + height * sizeof(Node*));
+        Node** next = reinterpret_cast<Node**>(static_cast<unsigned char*>(memory) + sizeof(Node));
+        try {
+            return ::new (memory) Node(key, value, height, next);
+        } catch (...) {
+            ::operator delete(memory);
+            throw;
+        }
+    }
+
+    static void destroyNode(Node* node) noexcept {
+        node->~Node();
+        ::operator delete(static_cast<void*>(node));
+    }
+
+    // Each level holds a quarter of the entries of the one below it
+    size_t randomHeight() noexcept {
+        size_t result = 1;
+        while (result < MaxHeight) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            if ((seed & 3) != 0) break;
+            result++;
+        }
+        return result;
+    }
+
+    // Fills links with, for every level, the link that points to the first entry whose key is not less than key
+    Node* search(const K& key, Node** links[MaxHeight]) const noexcept {
+        Node** current = const_cast<Node**>(heads);
+        for (size_t level = height; level-- > 0;) {
+            while (current[level] != nullptr && current[level]->key < key) current = current[level]->next;
+            links[level] = &current[level];
+        }
+        return height == 0 ? nullptr : current[0];
+    }
+
+    Node* lowerBoundNode(const K& key) const noexcept {
+        Node** current = const_cast<Node**>(heads);
+        for (size_t level = height; level-- > 0;) {
+            while (current[level] != nullptr && current[level]->key < key) current = current[level]->next;
+        }
+        return height == 0 ? nullptr : current[0];
+    }
+
+    Node* findNode(const K& key) const noexcept {
+        Node* node = lowerBoundNode(key);
+        return node != nullptr && !(key < node->key) ? node : nullptr;
+    }
+public:
+    typedef SkipListNode<K, V> Entry;
+
+    class Iterator {
+        friend class SkipList;
+    private:
+        Node* current;
+    public:
+        Iterator(Node* current = nullptr) : current(current) {}
+        bool operator==(const Iterator& other) const noexcept { return current == other.current; }
+        bool operator!=(const Iterator& other) const noexcept { return current != other.current; }
+        Entry& operator*() const { return *current; }
+        Entry* operator->() const { return current; }
+        Iterator operator++() {
+            Iterator tmp = Iterator(current);
+            if (current != nullptr) current = current->next[0];
+            return tmp;
+        }
+    };
+
+    typedef Iterator iterator;
+    iterator begin() const { return iterator(heads[0]); }
+    iterator end() const { return iterator(nullptr); }
+
+    // Entries whose keys lie in [from, to), in increasing order
+    class Range {
+        iterator first;
+        iterator last;
+    public:
+        Range(iterator first, iterator last) : first(first), last(last) {}
+        iterator begin() const { return first; }
+        iterator end() const { return last; }
+    };
+
+    SkipList() : height(0), count(0), seed(0x9E3779B97F4A7C15ull) {
+        for (auto& head: heads) head = nullptr;
+    }
+
+    SkipList(const SkipList& other) : SkipList() {
+        // Entries come in order, each one is appended after the last one of every level it spans
+        Node** lasts[MaxHeight];
+        for (size_t level = 0; level < MaxHeight; level++) lasts[level] = &heads[level];
+        for (const auto& entry: other) {
+            Node* node = createNode(entry.key, entry.value, entry.height);
+            for (size_t level = 0; level < node->height; level++) {
+                node->next[level] = nullptr;
+                *lasts[level] = node;
+                lasts[level] = &node->next[level];
+            }
+            count++;
+        }
+        height = other.height;
+    }
+
+    SkipList(SkipList&& other) noexcept : SkipList() {
+        swap(other);
+    }
+
+    ~SkipList() {
+        clear();
+    }
+
+    SkipList& operator=(const SkipList& other) {
+        if (this == &other) return *this;
+        SkipList copy(other);
+        swap(copy);
+        return *this;
+    }
+
+    SkipList& operator=(SkipList&& other) noexcept {
+        if (this == &other) return *this;
+        clear();
+        swap(other);
+        return *this;
+    }
+
+    bool operator==(const SkipList& other) const {
+        if (size() != other.size()) return false;
+        iterator it = other.begin();
+        for (const auto& entry: *this) {
+            if (entry.key < it->key || it->key < entry.key || entry.value != it->value) return false;
+            ++it;
+        }
+        return true;
+    }
+
+    bool operator!=(const SkipList& other) const {
+        return !((*this) == other);
+    }
+
+    bool empty() const noexcept {
+        return count == 0;
+    }
+
+    size_t size() const noexcept {
+        return count;
+    }
+
+    bool contains(const K& key) const noexcept {
+        return findNode(key) != nullptr;
+    }
+
+    // Throws IllegalAccessException if there is no entry for key
+    V& get(const K& key) {
+        Node* node = findNode(key);
+        if (node == nullptr) throw IllegalAccessException();
+        return node->value;
+    }
+
+    const V& get(const K& key) const {
+        Node* node = findNode(key);
+        if (node == nullptr) throw IllegalAccessException();
+        return node->value;
+    }
+
+    iterator find(const K& key) const noexcept {
+        return iterator(findNode(key));
+    }
+
+    // First entry whose key is not less than key
+    iterator lowerBound(const K& key) const noexcept {
+        return iterator(lowerBoundNode(key));
+    }
+
+    Range range(const K& from, const K& to) const noexcept {
+        if (!(from < to)) return Range(end(), end());
+        return Range(lowerBound(from), lowerBound(to));
+    }
+
+    // Adds an entry for key, returns false and leaves the list untouched if there already was one
+    bool insert(const K& key, const V& value) {
+        Node** links[MaxHeight];
+        Node* found = search(key, links);
+        if (found != nullptr && !(key < found->key)) return false;
+
+        size_t nodeHeight = randomHeight();
+        Node* node = createNode(key, value, nodeHeight);
+        for (; height < nodeHeight; height++) links[height] = &heads[height];
+        for (size_t level = 0; level < nodeHeight; level++) {
+            node->next[level] = *links[level];
+            *links[level] = node;
+        }
+        count++;
+        return true;
+    }
+
+    // Removes the entry for key, returns false if there was none
+    bool erase(const K& key) {
+        Node** links[MaxHeight];
+        Node* node = search(key, links);
+        if (node == nullptr || key < node->key) return false;
+
+        for (size_t level = 0; level < node->height; level++) *links[level] = node->next[level];
+        while (height > 0 && heads[height - 1] == nullptr) height--;
+        destroyNode(node);
+        count--;
+        return true;
+    }
+
+    void clear() noexcept {
+        Node* node = heads[0];
+        while (node != nullptr) {
+            Node* next = node->next[0];
+            destroyNode(node);
+            node = next;
+        }
+        for (auto& head: heads) head = nullptr;
+        height = 0;
+        count = 0;
+    }
+
+    void swap(SkipList& other) noexcept {
+        for (size_t level = 0; level < MaxHeight; level++) std::swap(heads[level], other.heads[level]);
+        std::swap(height, other.height);
+        std::swap(count, other.count);
+        std::swap(seed, other.seed);
+    }
+};
+
+#endif
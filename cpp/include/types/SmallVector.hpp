@@ -0,0 +1,506 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include "types/BoundsCheck.hpp"
+#include "types/BulkOperations.hpp"
+#include "types/Exceptions.hpp"
+#include "types/Expressions.hpp"
+#include "types/SimdKernels.hpp"
+
+#include <cstddef>
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <initializer_list>
+
+/*
+ * Vector keeping its first N elements inside the object itself, the heap is only used past N elements.
+ * Offers the same operations as Vector, without its allocation and growth policies: the heap buffer comes from
+ * malloc and doubles as it grows, so reserve and reserveExact are the same.
+ */
+template <typename T, size_t N, typename BoundsCheck = DefaultBoundsCheck>
+class SmallVector {
+    static_assert(N > 0, "SmallVector needs room for at least one inline element");
+    static_assert(alignof(T) <= alignof(std::max_align_t), "SmallVector heap storage is only aligned for fundamental types");
+
+    static constexpr bool isTriviallyRelocatable = std::is_trivially_copyable<T>::value;
+
+    alignas(T) unsigned char inlineItems[N * sizeof(T)];
+    T* memory = reinterpret_cast<T*>(inlineItems);
+    size_t allocatedSize = N;
+    size_t count = 0;
+
+    T* inlineMemory() noexcept {
+        return reinterpret_cast<T*>(inlineItems);
+    }
+
+    static void transfer(T* from, size_t size, T* to) {
+        if constexpr (std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value) {
+            std::uninitialized_move(from, from + size, to);
+        } else {
+            std::uninitialized_copy(from, from + size, to);
+        }
+    }
+
+    void relocate(size_t newSize) {
+        if (isInline() || !isTriviallyRelocatable) {
+            T* newMemory = static_cast<T*>(std::malloc(sizeof(T) * newSize));
+            if (newMemory == nullptr) throw std::bad_alloc();
+            try {
+                transfer(memory, count, newMemory);
+            } catch (...) {
+                std::free(newMemory);
+                throw;
+            }
+            std::destroy(memory, memory + count);
+            if (!isInline()) std::free(memory);
+            memory = newMemory;
+        } else {
+            void* newMemory = std::realloc(static_cast<void*>(memory), sizeof(T) * newSize);
+            if (newMemory == nullptr) throw std::bad_alloc();
+            memory = static_cast<T*>(newMemory);
+        }
+        allocatedSize = newSize;
+    }
+
+    // Moves the elements back to the inline buffer, they must fit
+    void relocateInline() {
+        T* heapMemory = memory;
+        transfer(heapMemory, count, inlineMemory());
+        std::destroy(heapMemory, heapMemory + count);
+        std::free(heapMemory);
+        memory = inlineMemory();
+        allocatedSize = N;
+    }
+
+    void grow(size_t required) {
+        reserve(allocatedSize * 2 > required ? allocatedSize * 2 : required);
+    }
+
+    template <typename It>
+    static constexpr bool isForwardIterator() noexcept {
+        return std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>::value;
+    }
+
+    // Whether the range starting at first is made of elements of this vector, which growing would invalidate
+    template <typename It>
+    bool aliases(const It& first) const noexcept {
+        if constexpr (std::is_convertible<It, const T*>::value) {
+            std::less_equal<const T*> before;
+            return count > 0 && before(memory, first) && before(first, memory + count - 1);
+        } else {
+            return false;
+        }
+    }
+
+    // Takes over the heap buffer of other, or moves its inline elements over
+    void steal(SmallVector& other) {
+        if (other.isInline()) {
+            reserve(other.count);
+            transfer(other.memory, other.count, memory);
+            count = other.count;
+            other.clear();
+        } else {
+            memory = other.memory;
+            allocatedSize = other.allocatedSize;
+            count = other.count;
+            other.memory = other.inlineMemory();
+            other.allocatedSize = N;
+            other.count = 0;
+        }
+    }
+public:
+    SmallVector() noexcept {}
+
+    SmallVector(size_t size, const T& value) {
+        reserve(size);
+        std::uninitialized_fill_n(memory, size, value);
+        count = size;
+    }
+
+    SmallVector(const SmallVector& other) {
+        reserve(other.size());
+        copyConstructElements(memory, other.memory, other.size());
+        count = other.size();
+    }
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        steal(other);
+    }
+
+    // Computes an element-wise expression of arithmetic vectors in a single pass, see Expressions.hpp
+    template <typename E, typename = std::enable_if_t<IsExpression<E>::value>>
+    SmallVector(const E& expression) {
+        reserve(expression.size());
+        SimdKernels<T>::evaluate(memory, expression, expression.size());
+        count = expression.size();
+    }
+
+    SmallVector(std::initializer_list<T> list) {
+        reserve(list.size());
+        copyConstructElements(memory, list.begin(), list.size());
+        count = list.size();
+    }
+
+    ~SmallVector() {
+        deallocate();
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this == &other) return *this;
+        clear();
+        reserve(other.size());
+        copyConstructElements(memory, other.memory, other.size());
+        count = other.size();
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this == &other) return *this;
+        if (other.isInline()) {
+            clear();
+        } else {
+            deallocate();
+        }
+        steal(other);
+        return *this;
+    }
+
+    // Evaluates in place when the sizes match, the expression may read this very vector
+    template <typename E, typename = std::enable_if_t<IsExpression<E>::value>>
+    SmallVector& operator=(const E& expression) {
+        if (expression.size() != size()) {
+            SmallVector result(expression);
+            swap(result);
+        } else {
+            SimdKernels<T>::evaluate(memory, expression, count);
+        }
+        return *this;
+    }
+
+    T& operator[](size_t index) {
+        BoundsCheck::check(index, count);
+        return memory[index];
+    }
+
+    const T& operator[](size_t index) const {
+        BoundsCheck::check(index, count);
+        return memory[index];
+    }
+
+    T& at(size_t index) {
+        CheckedBounds::check(index, count);
+        return memory[index];
+    }
+
+    const T& at(size_t index) const {
+        CheckedBounds::check(index, count);
+        return memory[index];
+    }
+
+    bool operator==(const SmallVector& other) const {
+        return size() == other.size() && equalElements(memory, other.memory, size());
+    }
+
+    bool operator!=(const SmallVector& other) const {
+        return !((*this) == other);
+    }
+
+    typedef T* iterator;
+    typedef const T* const_iterator;
+
+    constexpr iterator begin() noexcept {
+        return iterator(memory);
+    }
+
+    constexpr const_iterator cbegin() noexcept {
+        return const_iterator(memory);
+    }
+
+    constexpr iterator begin() const noexcept {
+        return iterator(memory);
+    }
+
+    constexpr const_iterator cbegin() const noexcept {
+        return const_iterator(memory);
+    }
+
+    constexpr iterator end() noexcept {
+        return iterator(memory + size());
+    }
+
+    constexpr const_iterator cend() noexcept {
+        return const_iterator(memory + size());
+    }
+
+    constexpr iterator end() const noexcept {
+        return iterator(memory + size());
+    }
+
+    constexpr const_iterator cend() const noexcept {
+        return const_iterator(memory + size());
+    }
+
+    bool empty() const noexcept {
+        return count == 0;
+    }
+
+    size_t size() const noexcept {
+        return count;
+    }
+
+    size_t capacity() const noexcept {
+        return allocatedSize;
+    }
+
+    // True while the elements still live in the inline buffer
+    bool isInline() const noexcept {
+        return memory == reinterpret_cast<const T*>(inlineItems);
+    }
+
+    void reserve(size_t newSize) {
+        if (newSize <= capacity()) return;
+        relocate(newSize);
+    }
+
+    // Same as reserve, the heap buffer is always allocated to the exact size
+    void reserveExact(size_t newSize) {
+        reserve(newSize);
+    }
+
+    // Releases the capacity beyond the size, going back to the inline buffer when the elements fit in it
+    void shrinkToFit() {
+        if (isInline() || count == capacity()) return;
+        if (count <= N) {
+            relocateInline();
+        } else {
+            relocate(count);
+        }
+    }
+
+    void resize(size_t newSize, const T& value = {}) {
+        if (size() > newSize) {
+            erase(newSize, size());
+        } else if (size() < newSize) {
+            // value may live inside the buffer about to be relocated
+            T copy(value);
+            reserve(newSize);
+            std::uninitialized_fill_n(memory + count, newSize - count, copy);
+            count = newSize;
+        }
+    }
+
+    void push(const T& element) {
+        if (count + 1 > capacity()) {
+            // element may live inside the buffer about to be relocated
+            T copy(element);
+            grow(count + 1);
+            ::new (static_cast<void*>(memory + count)) T(std::move(copy));
+        } else {
+            ::new (static_cast<void*>(memory + count)) T(element);
+        }
+        count++;
+    }
+
+    void push(T&& element) {
+        if (count + 1 > capacity()) {
+            T moved(std::move(element));
+            grow(count + 1);
+            ::new (static_cast<void*>(memory + count)) T(std::move(moved));
+        } else {
+            ::new (static_cast<void*>(memory + count)) T(std::move(element));
+        }
+        count++;
+    }
+
+    void insert(size_t at, const T& value) {
+        if (at >= size()) throwIllegalIndex(at);
+        emplace(at, value);
+    }
+
+    // Inserts [first, last) before the element at index at, which may be size() to append, see Vector::insert
+    template <typename It, typename = std::enable_if_t<!std::is_integral<It>::value>>
+    void insert(size_t at, It first, It last) {
+        if (at > count) throwIllegalIndex(at);
+        size_t oldCount = count;
+        if constexpr (std::is_trivially_copyable<T>::value && isForwardIterator<It>()) {
+            size_t added = std::distance(first, last);
+            if (added == 0) return;
+            if (aliases(first)) {
+                SmallVector copy;
+                copy.append(first, last);
+                insert(at, copy.begin(), copy.end());
+                return;
+            }
+            if (count + added > capacity()) grow(count + added);
+            std::move_backward(memory + at, memory + count, memory + count + added);
+            std::uninitialized_copy(first, last, memory + at);
+            count += added;
+        } else {
+            append(first, last);
+            std::rotate(memory + at, memory + oldCount, memory + count);
+        }
+    }
+
+    void insert(size_t at, std::initializer_list<T> list) {
+        insert(at, list.begin(), list.end());
+    }
+
+    // Constructs an element from args before the element at index at, which may be size() to append
+    template <typename... Args>
+    T& emplace(size_t at, Args&&... args) {
+        if (at > count) throwIllegalIndex(at);
+        // args may refer to elements about to be moved
+        T value(std::forward<Args>(args)...);
+        if (at == count) {
+            push(std::move(value));
+        } else {
+            if (count + 1 > capacity()) grow(count + 1);
+            ::new (static_cast<void*>(memory + count)) T(std::move(memory[count - 1]));
+            count++;
+            std::move_backward(memory + at, memory + count - 2, memory + count - 1);
+            memory[at] = std::move(value);
+        }
+        return memory[at];
+    }
+
+    // Appends [first, last), reserving once when the size of the range is known
+    template <typename It, typename = std::enable_if_t<!std::is_integral<It>::value>>
+    void append(It first, It last) {
+        if constexpr (isForwardIterator<It>()) {
+            size_t added = std::distance(first, last);
+            if (added == 0) return;
+            if (aliases(first)) {
+                SmallVector copy;
+                copy.append(first, last);
+                append(copy.begin(), copy.end());
+                return;
+            }
+            if (count + added > capacity()) grow(count + added);
+            std::uninitialized_copy(first, last, memory + count);
+            count += added;
+        } else {
+            for (; first != last; ++first) push(*first);
+        }
+    }
+
+    template <typename Range>
+    void append(const Range& range) {
+        append(std::begin(range), std::end(range));
+    }
+
+    void append(std::initializer_list<T> list) {
+        append(list.begin(), list.end());
+    }
+
+    void erase(size_t at) {
+        if (at >= count) throwIllegalIndex(at);
+        erase(at, at + 1);
+    }
+
+    // Erases the elements at indexes [from, to), shifting the following ones once
+    void erase(size_t from, size_t to) {
+        if (to > count) throwIllegalIndex(to);
+        if (from > to) throwIllegalIndex(from);
+        std::move(memory + to, memory + count, memory + from);
+        std::destroy(memory + count - (to - from), memory + count);
+        count -= to - from;
+    }
+
+    void pop() {
+        erase(size() - 1);
+    }
+
+    void clear() noexcept {
+        std::destroy(memory, memory + count);
+        count = 0;
+    }
+
+    // Releases the heap buffer if any, the vector goes back to its inline storage
+    void deallocate() noexcept {
+        clear();
+        if (!isInline()) std::free(memory);
+        memory = inlineMemory();
+        allocatedSize = N;
+    }
+
+    const T& first() const {
+        return (*this)[0];
+    }
+
+    const T& last() const {
+        return (*this)[size() - 1];
+    }
+
+    void fill(const T& value) noexcept {
+        fillElements(memory, count, value);
+    }
+
+    // Vectorized kernels, for arithmetic elements only (see SimdKernels.hpp)
+    T sum() const {
+        return SimdKernels<T>::sum(memory, count);
+    }
+
+    // Throws IllegalAccessException if empty
+    T min() const {
+        if (empty()) throw IllegalAccessException();
+        return SimdKernels<T>::min(memory, count);
+    }
+
+    T max() const {
+        if (empty()) throw IllegalAccessException();
+        return SimdKernels<T>::max(memory, count);
+    }
+
+    // Throws IllegalAccessException if the sizes differ
+    T dot(const SmallVector& other) const {
+        if (size() != other.size()) throw IllegalAccessException();
+        return SimdKernels<T>::dot(memory, other.memory, count);
+    }
+
+    // Adds alpha * x[i] to every element i, throws IllegalAccessException if the sizes differ
+    void axpy(const T& alpha, const SmallVector& x) {
+        if (size() != x.size()) throw IllegalAccessException();
+        SimdKernels<T>::axpy(alpha, x.memory, memory, count);
+    }
+
+    // First element equal to value, end() if there is none
+    iterator find(const T& value) const {
+        return begin() + SimdKernels<T>::find(memory, count, value);
+    }
+
+    // Number of elements equal to value
+    size_t occurrences(const T& value) const {
+        return SimdKernels<T>::count(memory, count, value);
+    }
+
+    void swap(SmallVector& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (!isInline() && !other.isInline()) {
+            std::swap(memory, other.memory);
+            std::swap(allocatedSize, other.allocatedSize);
+            std::swap(count, other.count);
+        } else {
+            SmallVector tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+        }
+    }
+
+    void swap(size_t a, size_t b) {
+        T tmp = std::move(memory[a]);
+        memory[a] = std::move(memory[b]);
+        memory[b] = std::move(tmp);
+    }
+};
+
+template <typename T, size_t N, typename BoundsCheck>
+struct ExpressionContainer<SmallVector<T, N, BoundsCheck>> : std::is_arithmetic<T> {
+    typedef T value_type;
+};
+
+#endif
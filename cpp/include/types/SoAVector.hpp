@@ -0,0 +1,384 @@
+#ifndef SOA_VECTOR_HPP
+#define SOA_VECTOR_HPP
+
+#include "types/Allocation.hpp"
+#include "types/BoundsCheck.hpp"
+#include "types/Growth.hpp"
+#include "types/Vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Contiguous elements owned by someone else, e.g. a column of a SoAVector
+template <typename T, typename BoundsCheck = DefaultBoundsCheck>
+class ColumnSpan {
+    T* memory;
+    size_t count;
+public:
+    ColumnSpan(T* memory, size_t count) noexcept : memory(memory), count(count) {}
+
+    T& operator[](size_t index) const {
+        BoundsCheck::check(index, count);
+        return memory[index];
+    }
+
+    T& at(size_t index) const {
+        CheckedBounds::check(index, count);
+        return memory[index];
+    }
+
+    typedef T* iterator;
+
+    T* data() const noexcept {
+        return memory;
+    }
+
+    iterator begin() const noexcept {
+        return memory;
+    }
+
+    iterator end() const noexcept {
+        return memory + count;
+    }
+
+    bool empty() const noexcept {
+        return count == 0;
+    }
+
+    size_t size() const noexcept {
+        return count;
+    }
+};
+
+/*
+ * Vector of records stored as a structure of arrays: each field lives in its own column, contiguous and aligned on
+ * a cache line, so that a loop reading a few fields of every record only loads those fields, and can be vectorized
+ * over them. Row i is made of the elements i of every column.
+ * Rows are accessed through tuples of references to their fields (std::tuple<A&, B&...>), which work with std::get
+ * and structured bindings, and can be assigned a std::tuple<A, B...>. The iterators yield such tuples rather than
+ * true references, so reordering goes through sort(), sortBy() or permute() instead of std::sort, moving each
+ * column once.
+ */
+template <typename... Fields>
+class SoAVector {
+    static_assert(sizeof...(Fields) > 0, "SoAVector needs at least one field");
+
+    template <typename T>
+    using Column = Vector<T, UncheckedBounds, AlignedAllocation<64>>;
+
+    typedef std::index_sequence_for<Fields...> Indexes;
+
+    // All the same size and capacity
+    std::tuple<Column<Fields>...> columns;
+
+    template <typename F>
+    void forEachColumn(F&& f) {
+        std::apply([&f](auto&... column) { (f(column), ...); }, columns);
+    }
+
+    template <size_t... I>
+    std::tuple<Fields&...> row(size_t index, std::index_sequence<I...>) noexcept {
+        return std::tuple<Fields&...>(std::get<I>(columns).begin()[index]...);
+    }
+
+    template <size_t... I>
+    std::tuple<const Fields&...> row(size_t index, std::index_sequence<I...>) const noexcept {
+        return std::tuple<const Fields&...>(std::get<I>(columns).begin()[index]...);
+    }
+
+    // The capacity of every column is already enough, only the constructors of the fields may throw
+    template <size_t... I, typename... Args>
+    void construct(std::index_sequence<I...>, Args&&... values) {
+        size_t pushed = 0;
+        try {
+            ((std::get<I>(columns).push(std::forward<Args>(values)), pushed++), ...);
+        } catch (...) {
+            // Keeps the columns the same size
+            size_t column = 0;
+            ((column++ < pushed ? std::get<I>(columns).pop() : void()), ...);
+            throw;
+        }
+    }
+
+    template <size_t... I>
+    void constructMoved(std::index_sequence<I...> indexes, std::tuple<Fields...>& values) {
+        construct(indexes, std::move(std::get<I>(values))...);
+    }
+
+    // Moves the elements of every column to permuted in the given order, or copies them if moving may throw
+    template <size_t... I>
+    void permuteInto(const Vector<size_t>& order, std::tuple<Column<Fields>...>& permuted, std::index_sequence<I...>) {
+        auto gather = [&order](auto& column, auto& destination) {
+            destination.reserveExact(column.size());
+            for (size_t index: order) destination.push(std::move_if_noexcept(column.begin()[index]));
+        };
+        (gather(std::get<I>(columns), std::get<I>(permuted)), ...);
+    }
+
+    template <typename... Args>
+    void pushRow(Args&&... values) {
+        if (size() == capacity()) {
+            // values may live inside the columns about to be relocated
+            std::tuple<Fields...> copy(std::forward<Args>(values)...);
+            reserve(DoublingGrowth::grow(capacity(), 0));
+            constructMoved(Indexes(), copy);
+        } else {
+            construct(Indexes(), std::forward<Args>(values)...);
+        }
+    }
+
+    template <bool Const>
+    class Iterator {
+        friend class SoAVector;
+        friend class Iterator<!Const>;
+        typedef typename std::conditional<Const, const SoAVector, SoAVector>::type Container;
+        Container* container;
+        size_t index;
+
+        Iterator(Container* container, size_t index) noexcept : container(container), index(index) {}
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef std::tuple<Fields...> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef void pointer;
+        typedef typename std::conditional<Const, std::tuple<const Fields&...>, std::tuple<Fields&...>>::type reference;
+
+        Iterator() noexcept : container(nullptr), index(0) {}
+
+        // iterator converts to const_iterator
+        template <bool C = Const, typename = std::enable_if_t<!C>>
+        operator Iterator<true>() const noexcept { return Iterator<true>(container, index); }
+
+        reference operator*() const noexcept { return container->row(index, Indexes()); }
+        reference operator[](difference_type offset) const noexcept { return container->row(index + offset, Indexes()); }
+
+        Iterator& operator++() noexcept { index++; return *this; }
+        Iterator operator++(int) noexcept { Iterator old = *this; index++; return old; }
+        Iterator& operator--() noexcept { index--; return *this; }
+        Iterator operator--(int) noexcept { Iterator old = *this; index--; return old; }
+        Iterator& operator+=(difference_type offset) noexcept { index += offset; return *this; }
+        Iterator& operator-=(difference_type offset) noexcept { index -= offset; return *this; }
+        Iterator operator+(difference_type offset) const noexcept { return Iterator(container, index + offset); }
+        Iterator operator-(difference_type offset) const noexcept { return Iterator(container, index - offset); }
+        difference_type operator-(const Iterator& other) const noexcept { return (difference_type)index - (difference_type)other.index; }
+
+        bool operator==(const Iterator& other) const noexcept { return index == other.index; }
+        bool operator!=(const Iterator& other) const noexcept { return index != other.index; }
+        bool operator<(const Iterator& other) const noexcept { return index < other.index; }
+        bool operator>(const Iterator& other) const noexcept { return index > other.index; }
+        bool operator<=(const Iterator& other) const noexcept { return index <= other.index; }
+        bool operator>=(const Iterator& other) const noexcept { return index >= other.index; }
+    };
+public:
+    template <size_t I>
+    using Field = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    typedef std::tuple<Fields...> value_type;
+    typedef std::tuple<Fields&...> reference;
+    typedef std::tuple<const Fields&...> const_reference;
+
+    SoAVector() noexcept {}
+
+    SoAVector(std::initializer_list<value_type> list) {
+        reserve(list.size());
+        for (const value_type& values: list) std::apply([this](const Fields&... fields) { push(fields...); }, values);
+    }
+
+    reference operator[](size_t index) {
+        DefaultBoundsCheck::check(index, size());
+        return row(index, Indexes());
+    }
+
+    const_reference operator[](size_t index) const {
+        DefaultBoundsCheck::check(index, size());
+        return row(index, Indexes());
+    }
+
+    reference at(size_t index) {
+        CheckedBounds::check(index, size());
+        return row(index, Indexes());
+    }
+
+    const_reference at(size_t index) const {
+        CheckedBounds::check(index, size());
+        return row(index, Indexes());
+    }
+
+    bool operator==(const SoAVector& other) const {
+        return columns == other.columns;
+    }
+
+    bool operator!=(const SoAVector& other) const {
+        return !((*this) == other);
+    }
+
+    // Field I of every row
+    template <size_t I>
+    ColumnSpan<Field<I>> column() noexcept {
+        return ColumnSpan<Field<I>>(data<I>(), size());
+    }
+
+    template <size_t I>
+    ColumnSpan<const Field<I>> column() const noexcept {
+        return ColumnSpan<const Field<I>>(data<I>(), size());
+    }
+
+    // Aligned on 64 bytes
+    template <size_t I>
+    Field<I>* data() noexcept {
+        return std::get<I>(columns).begin();
+    }
+
+    template <size_t I>
+    const Field<I>* data() const noexcept {
+        return std::get<I>(columns).begin();
+    }
+
+    typedef Iterator<false> iterator;
+    typedef Iterator<true> const_iterator;
+
+    iterator begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    iterator end() noexcept {
+        return iterator(this, size());
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, size());
+    }
+
+    const_iterator cend() const noexcept {
+        return const_iterator(this, size());
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    size_t size() const noexcept {
+        return std::get<0>(columns).size();
+    }
+
+    size_t capacity() const noexcept {
+        return std::get<0>(columns).capacity();
+    }
+
+    void reserve(size_t newSize) {
+        forEachColumn([newSize](auto& column) { column.reserveExact(newSize); });
+    }
+
+    void shrinkToFit() {
+        forEachColumn([](auto& column) { column.shrinkToFit(); });
+    }
+
+    // One value per field
+    void push(const Fields&... values) {
+        pushRow(values...);
+    }
+
+    void push(Fields&&... values) {
+        pushRow(std::move(values)...);
+    }
+
+    void pop() {
+        if (empty()) throwIllegalIndex(0);
+        forEachColumn([](auto& column) { column.pop(); });
+    }
+
+    // New rows are default constructed
+    void resize(size_t newSize) {
+        size_t oldSize = size();
+        if (newSize > oldSize) reserve(newSize);
+        try {
+            forEachColumn([newSize](auto& column) { column.resize(newSize); });
+        } catch (...) {
+            forEachColumn([oldSize](auto& column) { if (column.size() > oldSize) column.erase(oldSize, column.size()); });
+            throw;
+        }
+    }
+
+    void clear() noexcept {
+        forEachColumn([](auto& column) { column.clear(); });
+    }
+
+    /*
+     * Reorders the rows so that row i is the one at order[i] before, each column being moved once.
+     * Throws IllegalIndexException, without changing anything, unless order holds every index below size() once.
+     * Fields whose move may throw are copied instead, so that an exception leaves the vector as it was.
+     */
+    void permute(const Vector<size_t>& order) {
+        if (order.size() != size()) throwIllegalIndex(order.size());
+        Vector<unsigned char> seen(size(), 0);
+        for (size_t index: order) {
+            if (index >= size() || seen[index]) throwIllegalIndex(index);
+            seen[index] = 1;
+        }
+        // Every column is permuted before any replaces the original, which stays intact should a field throw
+        std::tuple<Column<Fields>...> permuted;
+        permuteInto(order, permuted, Indexes());
+        columns.swap(permuted);
+    }
+
+    // Sorts the rows, compare(const_reference, const_reference) telling whether a row goes before another
+    template <typename Compare>
+    void sort(Compare compare) {
+        permute(sortedOrder([this, &compare](size_t a, size_t b) {
+            return compare(row(a, Indexes()), row(b, Indexes()));
+        }));
+    }
+
+    // Sorts the rows by field I, which is the only column read while sorting
+    template <size_t I, typename Compare = std::less<>>
+    void sortBy(Compare compare = Compare()) {
+        const Field<I>* keys = data<I>();
+        if constexpr (std::is_trivially_copyable<Field<I>>::value) {
+            // Sorting copies of the keys next to their indexes saves looking each key up at every comparison
+            Vector<std::pair<Field<I>, size_t>> pairs;
+            pairs.reserveExact(size());
+            for (size_t i = 0; i < size(); i++) pairs.push({keys[i], i});
+            std::sort(pairs.begin(), pairs.end(), [&compare](const auto& a, const auto& b) {
+                return compare(a.first, b.first);
+            });
+            Vector<size_t> order;
+            order.reserveExact(size());
+            for (const auto& pair: pairs) order.push(pair.second);
+            permute(order);
+        } else {
+            permute(sortedOrder([keys, &compare](size_t a, size_t b) {
+                return compare(keys[a], keys[b]);
+            }));
+        }
+    }
+
+    // Indexes of the rows, sorted by compare(size_t, size_t)
+    template <typename Compare>
+    Vector<size_t> sortedOrder(Compare compare) const {
+        Vector<size_t> order;
+        order.reserveExact(size());
+        for (size_t i = 0; i < size(); i++) order.push(i);
+        std::sort(order.begin(), order.end(), compare);
+        return order;
+    }
+
+    void swap(SoAVector& other) noexcept {
+        columns.swap(other.columns);
+    }
+};
+
+#endif
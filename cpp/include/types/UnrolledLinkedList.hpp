@@ -0,0 +1,320 @@
+#ifndef UNROLLED_LINKED_LIST_HPP
+#define UNROLLED_LINKED_LIST_HPP
+
+#include <cstdlib>
+#include "types/Exceptions.hpp"
+#include "types/NodePool.hpp"
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Node holding up to BlockSize consecutive elements of the list
+template <typename T, size_t BlockSize>
+struct UnrolledLinkedListNode {
+    alignas(T) unsigned char storage[BlockSize * sizeof(T)];
+    size_t count = 0;
+    UnrolledLinkedListNode<T, BlockSize>* next = nullptr;
+
+    UnrolledLinkedListNode(UnrolledLinkedListNode<T, BlockSize>* next = nullptr) : next(next) {}
+
+    ~UnrolledLinkedListNode() {
+        std::destroy(items(), items() + count);
+    }
+
+    T* items() noexcept { return reinterpret_cast<T*>(storage); }
+    const T* items() const noexcept { return reinterpret_cast<const T*>(storage); }
+
+    // Opens a gap at index at by shifting the following elements, the gap is left uninitialized
+    void openGap(size_t at) {
+        T* values = items();
+        if (at < count) {
+            ::new (static_cast<void*>(values + count)) T(std::move(values[count - 1]));
+            for (size_t i = count - 1; i > at; i--) values[i] = std::move(values[i - 1]);
+            std::destroy_at(values + at);
+        }
+    }
+
+    void remove(size_t at) {
+        T* values = items();
+        for (size_t i = at + 1; i < count; i++) values[i - 1] = std::move(values[i]);
+        std::destroy_at(values + count - 1);
+        count--;
+    }
+
+    // Moves the elements [from, count) to the beginning of the (empty) node other
+    void moveTail(size_t from, UnrolledLinkedListNode<T, BlockSize>& other) {
+        T* values = items();
+        std::uninitialized_move(values + from, values + count, other.items() + other.count);
+        std::destroy(values + from, values + count);
+        other.count += count - from;
+        count = from;
+    }
+};
+
+// Linked list storing its elements by blocks of BlockSize, trading a bit of memory for near contiguous traversals
+template <typename T, size_t BlockSize = 16, typename Allocator = NodePool<UnrolledLinkedListNode<T, BlockSize>>>
+class UnrolledLinkedList {
+    static_assert(BlockSize > 1, "UnrolledLinkedList blocks need room for at least two elements");
+
+    typedef UnrolledLinkedListNode<T, BlockSize> Node;
+
+    Node* head;
+    Node* tail;
+    size_t count;
+    Allocator allocator;
+
+    Node* createNode(Node* next) {
+        Node* node = allocator.allocate();
+        ::new (static_cast<void*>(node)) Node(next);
+        return node;
+    }
+
+    void destroyNode(Node* node) noexcept {
+        node->~Node();
+        allocator.deallocate(node);
+    }
+
+    // Finds the node holding the element at index at, along with its offset inside that node and its predecessor
+    Node* locate(size_t at, size_t& offset, Node** previous = nullptr) const noexcept {
+        if (at >= count) return nullptr;
+        Node* before = nullptr;
+        Node* current = head;
+        if (at >= count - tail->count && previous == nullptr) {
+            offset = at - (count - tail->count);
+            return tail;
+        }
+        while (at >= current->count) {
+            at -= current->count;
+            before = current;
+            current = current->next;
+        }
+        if (previous != nullptr) *previous = before;
+        offset = at;
+        return current;
+    }
+
+    // Splits a full node in two halves, returns the node that now holds the element at offset (updated accordingly)
+    Node* split(Node* node, size_t& offset) {
+        Node* added = createNode(node->next);
+        node->moveTail(BlockSize / 2, *added);
+        node->next = added;
+        if (node == tail) tail = added;
+        if (offset <= node->count) return node;
+        offset -= node->count;
+        return added;
+    }
+
+    void insertAt(Node* node, size_t offset, const T& value) {
+        // value may be an element of the node, which splitting or opening the gap moves or destroys
+        T copy(value);
+        if (node->count == BlockSize) node = split(node, offset);
+        node->openGap(offset);
+        ::new (static_cast<void*>(node->items() + offset)) T(std::move(copy));
+        node->count++;
+        count++;
+    }
+
+    void clear(Node* node) {
+        if (!allocator.releasesInBulk()) {
+            while (node != nullptr) {
+                Node* next = node->next;
+                destroyNode(node);
+                node = next;
+            }
+        } else if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (; node != nullptr; node = node->next) node->~Node();
+        }
+        allocator.release();
+    }
+public:
+    class Iterator {
+        friend class UnrolledLinkedList;
+    private:
+        Node* current;
+        size_t offset;
+    public:
+        Iterator(Node* current = nullptr, size_t offset = 0) : current(current), offset(offset) {}
+        bool operator==(const Iterator& other) const noexcept { return current == other.current && offset == other.offset; }
+        bool operator!=(const Iterator& other) const noexcept { return !((*this) == other); }
+        T& operator*() const { return current->items()[offset]; }
+        Iterator operator++() {
+            Iterator tmp = Iterator(current, offset);
+            if (current != nullptr && ++offset == current->count) {
+                current = current->next;
+                offset = 0;
+            }
+            return tmp;
+        }
+    };
+
+    typedef Iterator iterator;
+    iterator begin() const { return iterator(head); }
+    iterator end() const { return iterator(nullptr); }
+
+    UnrolledLinkedList() : head(nullptr), tail(nullptr), count(0) {}
+
+    UnrolledLinkedList(UnrolledLinkedList& other) : UnrolledLinkedList() {
+        for(auto& value: other) push(value);
+    }
+
+    UnrolledLinkedList(const UnrolledLinkedList& other) : UnrolledLinkedList() {
+        for(auto& value: other) push(value);
+    }
+
+    UnrolledLinkedList(UnrolledLinkedList&& other) noexcept : UnrolledLinkedList() {
+        swap(other);
+    }
+
+    ~UnrolledLinkedList() {
+        clear();
+    }
+
+    UnrolledLinkedList& operator=(UnrolledLinkedList& other) {
+        return (*this) = (const UnrolledLinkedList&)other;
+    }
+
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& other) {
+        if (this == &other) return *this;
+        clear();
+        for(auto& value: other) push(value);
+        return *this;
+    }
+
+    UnrolledLinkedList& operator=(UnrolledLinkedList&& other) noexcept {
+        if (this == &other) return *this;
+        clear();
+        swap(other);
+        return *this;
+    }
+
+    T& operator[](size_t at) {
+        size_t offset;
+        Node* node = locate(at, offset);
+        if (node == nullptr) throw IllegalIndexException(at);
+        return node->items()[offset];
+    }
+
+    const T& operator[](size_t at) const {
+        size_t offset;
+        Node* node = locate(at, offset);
+        if (node == nullptr) throw IllegalIndexException(at);
+        return node->items()[offset];
+    }
+
+    bool operator==(const UnrolledLinkedList& other) const noexcept {
+        if (size() != other.size()) return false;
+        iterator it = other.begin();
+        for (const auto& value: *this) {
+            if (value != *it) return false;
+            ++it;
+        }
+        return true;
+    }
+
+    bool operator!=(const UnrolledLinkedList& other) const noexcept {
+        return !((*this) == other);
+    }
+
+    bool empty() const noexcept {
+        return count == 0;
+    }
+
+    size_t size() const noexcept {
+        return count;
+    }
+
+    void push(const T& value) {
+        if (tail == nullptr) {
+            head = tail = createNode(nullptr);
+        } else if (tail->count == BlockSize) {
+            // value may be an element of the current tail, construct it before linking a new node
+            T copy(value);
+            Node* added = createNode(nullptr);
+            ::new (static_cast<void*>(added->items())) T(std::move(copy));
+            added->count = 1;
+            tail->next = added;
+            tail = added;
+            count++;
+            return;
+        }
+        ::new (static_cast<void*>(tail->items() + tail->count)) T(value);
+        tail->count++;
+        count++;
+    }
+
+    void pop() noexcept {
+        if (empty()) return;
+        tail->remove(tail->count - 1);
+        count--;
+        if (tail->count == 0) {
+            Node* previous = nullptr;
+            if (head != tail) {
+                previous = head;
+                while (previous->next != tail) previous = previous->next;
+                previous->next = nullptr;
+            }
+            destroyNode(tail);
+            tail = previous;
+            if (tail == nullptr) head = nullptr;
+        }
+    }
+
+    void insertBefore(size_t at, const T& value) {
+        if (at == count) {
+            push(value);
+            return;
+        }
+        size_t offset;
+        Node* node = locate(at, offset);
+        if (node == nullptr) throw IllegalIndexException(at);
+        insertAt(node, offset, value);
+    }
+
+    void insertAfter(size_t at, const T& value) {
+        if (at >= count) throw IllegalIndexException(at);
+        insertBefore(at + 1, value);
+    }
+
+    void erase(size_t at) {
+        size_t offset;
+        Node* previous = nullptr;
+        Node* node = locate(at, offset, &previous);
+        if (node == nullptr) throw IllegalIndexException(at);
+        node->remove(offset);
+        count--;
+
+        if (node->count == 0) {
+            if (previous == nullptr) {
+                head = node->next;
+            } else {
+                previous->next = node->next;
+            }
+            if (node == tail) tail = previous;
+            destroyNode(node);
+        } else if (node->count < BlockSize / 2 && node->next != nullptr && node->count + node->next->count <= BlockSize) {
+            // Keep blocks reasonably full by merging sparse neighbours
+            Node* next = node->next;
+            next->moveTail(0, *node);
+            node->next = next->next;
+            if (next == tail) tail = node;
+            destroyNode(next);
+        }
+    }
+
+    void clear() {
+        clear(head);
+        head = nullptr;
+        tail = nullptr;
+        count = 0;
+    }
+
+    void swap(UnrolledLinkedList& other) noexcept {
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(count, other.count);
+        std::swap(allocator, other.allocator);
+    }
+};
+
+#endif
@@ -1,84 +1,172 @@
 #ifndef VECTOR_HPP
 #define VECTOR_HPP
 
-#include "types/Exceptions.hpp"
-
+#include "types/Allocation.hpp"
+#include "types/BoundsCheck.hpp"
+#include "types/BulkOperations.hpp"
+#include "types/Expressions.hpp"
+#include "types/Growth.hpp"
+#include "types/SimdKernels.hpp"
+
+#include <algorithm>
 #include <cstdlib>
+#include <functional>
+#include <iterator>
 #include <memory>
+#include <new>
 #include <cstring>
+#include <type_traits>
+#include <utility>
 #include <initializer_list>
 
-template <typename T>
+// Allocation decides where the elements live, e.g. AlignedAllocation<64> or HugePageAllocation (see Allocation.hpp),
+// Growth how the capacity increases, e.g. OneAndHalfGrowth or ChunkedGrowth<> (see Growth.hpp)
+template <typename T, typename BoundsCheck = DefaultBoundsCheck, typename Allocation = DefaultAllocation, typename Growth = DoublingGrowth>
 class Vector {
-    std::unique_ptr<T[]> memory = nullptr;
+    T* memory = nullptr;
     size_t allocatedSize = 0;
     size_t count = 0;
+
+    // Trivially copyable elements can be moved around as raw bytes, so growth can rely on realloc
+    static constexpr bool isTriviallyRelocatable = std::is_trivially_copyable<T>::value;
+    static_assert(alignof(T) <= Allocation::alignment, "Vector storage is not aligned enough for this type, see AlignedAllocation");
+
+    void relocate(size_t newSize) {
+        if constexpr (isTriviallyRelocatable) {
+            void* newMemory = Allocation::reallocate(static_cast<void*>(memory), sizeof(T) * allocatedSize, sizeof(T) * newSize);
+            memory = static_cast<T*>(newMemory);
+        } else {
+            T* newMemory = static_cast<T*>(Allocation::allocate(sizeof(T) * newSize));
+            try {
+                if constexpr (std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value) {
+                    std::uninitialized_move(memory, memory + count, newMemory);
+                } else {
+                    std::uninitialized_copy(memory, memory + count, newMemory);
+                }
+            } catch (...) {
+                Allocation::deallocate(newMemory, sizeof(T) * newSize);
+                throw;
+            }
+            std::destroy(memory, memory + count);
+            Allocation::deallocate(memory, sizeof(T) * allocatedSize);
+            memory = newMemory;
+        }
+        allocatedSize = newSize;
+    }
+
+    template <typename It>
+    static constexpr bool isForwardIterator() noexcept {
+        return std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>::value;
+    }
+
+    // Whether the range starting at first is made of elements of this vector, which growing would invalidate
+    template <typename It>
+    bool aliases(const It& first) const noexcept {
+        if constexpr (std::is_convertible<It, const T*>::value) {
+            std::less_equal<const T*> before;
+            return count > 0 && before(memory, first) && before(first, memory + count - 1);
+        } else {
+            return false;
+        }
+    }
+
+    // Makes room for at least required elements, following the growth policy
+    void grow(size_t required) {
+        size_t newSize = Growth::grow(allocatedSize, sizeof(T));
+        reserve(newSize > required ? newSize : required);
+    }
 public:
-    Vector() : allocatedSize(0), count(0), memory(nullptr) {}
+    Vector() noexcept {}
     
     Vector(size_t size, const T& value) {
         reserve(size);
-        for (size_t i = 0; i < size; i++) push(value);
+        std::uninitialized_fill_n(memory, size, value);
+        count = size;
     }
 
-    Vector(const Vector<T>& other) {
+    Vector(const Vector& other) {
         if (other.size() > 0) {
             reserve(other.size());
-            for (const auto& value: other) push(value);
+            copyConstructElements(memory, other.memory, other.size());
+            count = other.size();
         }
     }
 
-    Vector(Vector<T>&& other) {
-        if (other.size() > 0) {
-            reserve(other.size());
-            std::move(other.memory.get(), std::next(other.memory.get(), other.size()), memory.get());
-            count = other.count;
-            other.count = 0;
-            other.allocatedSize = 0;
-        }
+    Vector(Vector&& other) noexcept {
+        swap(other);
+    }
+
+    // Computes an element-wise expression of arithmetic Vectors in a single pass, see Expressions.hpp
+    template <typename E, typename = std::enable_if_t<IsExpression<E>::value>>
+    Vector(const E& expression) {
+        reserve(expression.size());
+        SimdKernels<T>::evaluate(memory, expression, expression.size());
+        count = expression.size();
     }
 
     Vector(std::initializer_list<T> list) {
         reserve(list.size());
-        for (auto& value: list) push(value);
+        copyConstructElements(memory, list.begin(), list.size());
+        count = list.size();
     }
 
-    T& operator=(const Vector<T>& other) {
+    ~Vector() {
+        deallocate();
+    }
+
+    Vector& operator=(const Vector& other) {
+        if (this == &other) return *this;
         clear();
         reserve(other.size());
-        for (const auto& value: other) push(value);
+        copyConstructElements(memory, other.memory, other.size());
+        count = other.size();
+        return *this;
     }
 
-    T& operator=(Vector<T>&& other) {
-        clear();
-        if (other.size > 0) {
-            reserve(other.size());
-            std::move(other.memory.get(), std::next(other.memory.get(), other.size()), memory.get());
-            count = other.count;
-            other.count = 0;
-            other.allocatedSize = 0;
+    Vector& operator=(Vector&& other) noexcept {
+        if (this == &other) return *this;
+        deallocate();
+        swap(other);
+        return *this;
+    }
+
+    // Evaluates in place when the sizes match, the expression may read this very vector
+    template <typename E, typename = std::enable_if_t<IsExpression<E>::value>>
+    Vector& operator=(const E& expression) {
+        if (expression.size() != size()) {
+            Vector result(expression);
+            swap(result);
+        } else {
+            SimdKernels<T>::evaluate(memory, expression, count);
         }
+        return *this;
     }
 
     T& operator[](size_t index) { 
-        if (index >= count) throw IllegalIndexException(index); 
+        BoundsCheck::check(index, count);
         return memory[index]; 
     }
 
     const T& operator[](size_t index) const { 
-        if (index >= count) throw IllegalIndexException(index); 
+        BoundsCheck::check(index, count);
         return memory[index]; 
     }
 
-    bool operator==(const Vector<T>& other) const {
-        if (size() != other.size()) return false;
-        for(size_t i = 0; i < size(); i++) {
-            if ((*this)[i] != other[i]) { return false; }
-        }
-        return true;
+    T& at(size_t index) {
+        CheckedBounds::check(index, count);
+        return memory[index];
+    }
+
+    const T& at(size_t index) const {
+        CheckedBounds::check(index, count);
+        return memory[index];
+    }
+
+    bool operator==(const Vector& other) const {
+        return size() == other.size() && equalElements(memory, other.memory, size());
     }
 
-    bool operator!=(const Vector<T>& other) const {
+    bool operator!=(const Vector& other) const {
         return !((*this) == other);
     }
 
@@ -86,35 +174,35 @@ public:
     typedef const T* const_iterator;
 
     constexpr iterator begin() noexcept { 
-        return iterator(memory.get()); 
+        return iterator(memory);
     }
 
     constexpr const_iterator cbegin() noexcept { 
-        return const_iterator(memory.get()); 
+        return const_iterator(memory);
     }
 
     constexpr iterator begin() const noexcept { 
-        return iterator(memory.get()); 
+        return iterator(memory);
     }
 
     constexpr const_iterator cbegin() const noexcept { 
-        return const_iterator(memory.get()); 
+        return const_iterator(memory);
     }
 
     constexpr iterator end() noexcept { 
-        return iterator(memory.get() + size()); 
+        return iterator(memory + size());
     }
 
     constexpr const_iterator cend() noexcept { 
-        return const_iterator(memory.get() + size()); 
+        return const_iterator(memory + size());
     }
 
     constexpr iterator end() const noexcept { 
-        return iterator(memory.get() + size()); 
+        return iterator(memory + size());
     }
 
     constexpr const_iterator cend() const noexcept { 
-        return const_iterator(memory.get() + size()); 
+        return const_iterator(memory + size());
     }    
 
     bool empty() const noexcept { 
@@ -129,47 +217,159 @@ public:
         return allocatedSize; 
     }
 
+    // Capacity rounded as the growth policy wants, e.g. to whole pages
     void reserve(size_t newSize) {
         if (newSize <= capacity()) return; 
-        T* newMemory = new T[newSize];
-        if (size() > 0) memcpy((void*)(newMemory), (void*)(memory.get()), sizeof(T) * size());
-        memory.reset(newMemory);
-        allocatedSize = newSize;
+        relocate(Growth::round(newSize, sizeof(T)));
     } 
 
-    void resize(size_t newSize, const T& value = {}) {
-        if (newSize == size()) {
-            return;
-        } else if (newSize < size()) {
-            for(size_t i = 0; i < size() - newSize; i++) pop();
+    // Capacity of exactly newSize elements, when the final size is known
+    void reserveExact(size_t newSize) {
+        if (newSize <= capacity()) return;
+        relocate(newSize);
+    }
+
+    // Releases the capacity beyond the size
+    void shrinkToFit() {
+        if (count == capacity()) return;
+        if (count == 0) {
+            deallocate();
         } else {
-            for(size_t i = 0; i < newSize - size(); i++) push(value);
+            relocate(count);
+        }
+    }
+
+    void resize(size_t newSize, const T& value = {}) {
+        if (size() > newSize) {
+            erase(newSize, size());
+        } else if (size() < newSize) {
+            // value may live inside the buffer about to be relocated
+            T copy(value);
+            reserve(newSize);
+            std::uninitialized_fill_n(memory + count, newSize - count, copy);
+            count = newSize;
         }
     }
 
     void push(const T& element) {
-        if (count + 1 > capacity()) reserve((allocatedSize == 0 ? 1 : allocatedSize * 2));
-        memory.get()[count] = element;
+        if (count + 1 > capacity()) {
+            // element may live inside the buffer about to be relocated
+            T copy(element);
+            grow(count + 1);
+            ::new (static_cast<void*>(memory + count)) T(std::move(copy));
+        } else {
+            ::new (static_cast<void*>(memory + count)) T(element);
+        }
         count++;
     }
 
     void push(T&& element) {
-        if (count + 1 > capacity()) reserve((allocatedSize == 0 ? 1 : allocatedSize * 2));
-        memory.get()[count] = std::move(element);
+        if (count + 1 > capacity()) {
+            T moved(std::move(element));
+            grow(count + 1);
+            ::new (static_cast<void*>(memory + count)) T(std::move(moved));
+        } else {
+            ::new (static_cast<void*>(memory + count)) T(std::move(element));
+        }
         count++;
     }
 
     void insert(size_t at, const T& value) {
-        if (at >= size()) throw IllegalIndexException(at);
-        push(last());
-        for(size_t i = size() - 1; i > at; i--) ((*this)[i]) = std::move((*this)[i - 1]);
-        ((*this)[at]) = value;
+        if (at >= size()) throwIllegalIndex(at);
+        emplace(at, value);
+    }
+
+    /*
+     * Inserts [first, last) before the element at index at, which may be size() to append. The elements after
+     * it are shifted once, as a single memmove when trivially copyable, and rotated into place otherwise.
+     * The range may be part of this vector only if It is a pointer.
+     */
+    template <typename It, typename = std::enable_if_t<!std::is_integral<It>::value>>
+    void insert(size_t at, It first, It last) {
+        if (at > count) throwIllegalIndex(at);
+        size_t oldCount = count;
+        if constexpr (std::is_trivially_copyable<T>::value && isForwardIterator<It>()) {
+            size_t added = std::distance(first, last);
+            if (added == 0) return;
+            if (aliases(first)) {
+                Vector copy;
+                copy.append(first, last);
+                insert(at, copy.begin(), copy.end());
+                return;
+            }
+            if (count + added > capacity()) grow(count + added);
+            std::move_backward(memory + at, memory + count, memory + count + added);
+            std::uninitialized_copy(first, last, memory + at);
+            count += added;
+        } else {
+            append(first, last);
+            std::rotate(memory + at, memory + oldCount, memory + count);
+        }
+    }
+
+    void insert(size_t at, std::initializer_list<T> list) {
+        insert(at, list.begin(), list.end());
+    }
+
+    // Constructs an element from args before the element at index at, which may be size() to append
+    template <typename... Args>
+    T& emplace(size_t at, Args&&... args) {
+        if (at > count) throwIllegalIndex(at);
+        // args may refer to elements about to be moved
+        T value(std::forward<Args>(args)...);
+        if (at == count) {
+            push(std::move(value));
+        } else {
+            if (count + 1 > capacity()) grow(count + 1);
+            ::new (static_cast<void*>(memory + count)) T(std::move(memory[count - 1]));
+            count++;
+            std::move_backward(memory + at, memory + count - 2, memory + count - 1);
+            memory[at] = std::move(value);
+        }
+        return memory[at];
+    }
+
+    // Appends [first, last), reserving once when the size of the range is known
+    template <typename It, typename = std::enable_if_t<!std::is_integral<It>::value>>
+    void append(It first, It last) {
+        if constexpr (isForwardIterator<It>()) {
+            size_t added = std::distance(first, last);
+            if (added == 0) return;
+            if (aliases(first)) {
+                Vector copy;
+                copy.append(first, last);
+                append(copy.begin(), copy.end());
+                return;
+            }
+            if (count + added > capacity()) grow(count + added);
+            std::uninitialized_copy(first, last, memory + count);
+            count += added;
+        } else {
+            for (; first != last; ++first) push(*first);
+        }
+    }
+
+    template <typename Range>
+    void append(const Range& range) {
+        append(std::begin(range), std::end(range));
+    }
+
+    void append(std::initializer_list<T> list) {
+        append(list.begin(), list.end());
     }
 
     void erase(size_t at) {
-        T& element = (*this)[at];
-        for(size_t i = at + 1; i < count; i++) (*this)[i - 1] = std::move((*this)[i]);
-        count--;
+        if (at >= count) throwIllegalIndex(at);
+        erase(at, at + 1);
+    }
+
+    // Erases the elements at indexes [from, to), shifting the following ones once
+    void erase(size_t from, size_t to) {
+        if (to > count) throwIllegalIndex(to);
+        if (from > to) throwIllegalIndex(from);
+        std::move(memory + to, memory + count, memory + from);
+        std::destroy(memory + count - (to - from), memory + count);
+        count -= to - from;
     }
 
     void pop() {
@@ -177,12 +377,14 @@ public:
     }  
 
     void clear() noexcept {
-        for (size_t i = 0; i < count; i++) pop();
+        std::destroy(memory, memory + count);
+        count = 0;
     }
 
     void deallocate() noexcept {
         clear();
-        memory.reset(nullptr);
+        Allocation::deallocate(memory, sizeof(T) * allocatedSize);
+        memory = nullptr;
         allocatedSize = 0;
     }
 
@@ -195,7 +397,51 @@ public:
     }
 
     void fill(const T& value) noexcept { 
-        for(size_t i = 0; i < size(); i++) memory[i] = value;
+        fillElements(memory, count, value);
+    }
+
+    // Vectorized kernels, for arithmetic elements only (see SimdKernels.hpp)
+    T sum() const {
+        return SimdKernels<T>::sum(memory, count);
+    }
+
+    // Throws IllegalAccessException if empty
+    T min() const {
+        if (empty()) throw IllegalAccessException();
+        return SimdKernels<T>::min(memory, count);
+    }
+
+    T max() const {
+        if (empty()) throw IllegalAccessException();
+        return SimdKernels<T>::max(memory, count);
+    }
+
+    // Throws IllegalAccessException if the sizes differ
+    T dot(const Vector& other) const {
+        if (size() != other.size()) throw IllegalAccessException();
+        return SimdKernels<T>::dot(memory, other.memory, count);
+    }
+
+    // Adds alpha * x[i] to every element i, throws IllegalAccessException if the sizes differ
+    void axpy(const T& alpha, const Vector& x) {
+        if (size() != x.size()) throw IllegalAccessException();
+        SimdKernels<T>::axpy(alpha, x.memory, memory, count);
+    }
+
+    // First element equal to value, end() if there is none
+    iterator find(const T& value) const {
+        return begin() + SimdKernels<T>::find(memory, count, value);
+    }
+
+    // Number of elements equal to value
+    size_t occurrences(const T& value) const {
+        return SimdKernels<T>::count(memory, count, value);
+    }
+
+    void swap(Vector& other) noexcept {
+        std::swap(memory, other.memory);
+        std::swap(allocatedSize, other.allocatedSize);
+        std::swap(count, other.count);
     }
 
     void swap(size_t a, size_t b) {
@@ -205,4 +451,9 @@ public:
     }
 };
 
+template <typename T, typename BoundsCheck, typename Allocation, typename Growth>
+struct ExpressionContainer<Vector<T, BoundsCheck, Allocation, Growth>> : std::is_arithmetic<T> {
+    typedef T value_type;
+};
+
 #endif
\ No newline at end of file
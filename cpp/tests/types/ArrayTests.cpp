@@ -1,6 +1,9 @@
 #include "catch.hpp"
 #include "types/Array.hpp"
 
+#include <string>
+#include <type_traits>
+
 TEST_CASE("Array constructors and copy semantics") {
     SECTION("Array::Array()") {
         Array<int, 3> arr;
@@ -158,4 +161,112 @@ TEST_CASE("Array Iterators") {
     }
 
     REQUIRE(result == 3);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Array bounds check policies") {
+    SECTION("at() always checks bounds") {
+        Array<int, 2, UncheckedBounds> arr(1);
+        const Array<int, 2, UncheckedBounds> carr(1);
+
+        REQUIRE(arr.at(1) == 1);
+        REQUIRE(carr.at(1) == 1);
+        REQUIRE_THROWS_AS(arr.at(2), IllegalIndexException);
+        REQUIRE_THROWS_AS(carr.at(2), IllegalIndexException);
+    }
+
+    SECTION("unchecked operator[]") {
+        Array<int, 3, UncheckedBounds> arr(0);
+        for (size_t i = 0; i < arr.size(); i++) arr[i] = (int)i;
+
+        REQUIRE(arr[0] == 0);
+        REQUIRE(arr[2] == 2);
+        REQUIRE_NOTHROW(arr[1]);
+    }
+
+    SECTION("asserted operator[]") {
+        Array<int, 3, AssertedBounds> arr(4);
+        REQUIRE(arr[2] == 4);
+    }
+}
+
+
+namespace {
+    // Reflected CRC-32 table, the kind of table that should never be computed at startup
+    constexpr Array<unsigned, 256> crcTable = Array<unsigned, 256>::generate([](size_t i) {
+        unsigned crc = (unsigned)i;
+        for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        return crc;
+    });
+
+    constexpr Array<int, 4> reversed(Array<int, 4> arr) {
+        arr.swap(0, 3);
+        arr.swap(1, 2);
+        return arr;
+    }
+}
+
+TEST_CASE("Array in constant expressions") {
+    static_assert(crcTable[0] == 0);
+    static_assert(crcTable[1] == 0x77073096u);
+    static_assert(crcTable[255] == 0x2D02EF8Du);
+
+    constexpr Array<int, 3> threes(3);
+    constexpr Array<int, 3> copy(threes);
+    static_assert(copy == threes);
+    static_assert(copy.at(2) == 3);
+    static_assert(copy.first() == 3 && copy.last() == 3);
+
+    constexpr auto ascending = Array<int, 4>::generate([](size_t i) { return (int)i; });
+    constexpr auto descending = reversed(ascending);
+    static_assert(descending[0] == 3 && descending[3] == 0);
+    static_assert(descending != ascending);
+    static_assert(*ascending.begin() == 0 && ascending.end() - ascending.begin() == 4);
+
+    // Still usable at runtime
+    Array<int, 4> runtime = ascending;
+    runtime.fill(1);
+    REQUIRE(runtime[3] == 1);
+    REQUIRE(crcTable[128] == 0xEDB88320u);
+}
+
+TEST_CASE("Array bulk copies, fills and comparisons") {
+    static_assert(std::is_trivially_copyable<Array<int, 4>>::value);
+
+    Array<int, 100> arr(0);
+    arr.fill(-1);
+    REQUIRE(arr[99] == -1);
+    arr.fill(7);
+    Array<int, 100> copy(arr);
+    REQUIRE(copy == arr);
+    copy[50] = 0;
+    REQUIRE(copy != arr);
+    copy = arr;
+    REQUIRE(copy == arr);
+
+    REQUIRE(Array<double, 2>(0.0) == Array<double, 2>(-0.0));
+    Array<std::string, 2> strings("a");
+    Array<std::string, 2> stringsCopy(strings);
+    REQUIRE(stringsCopy == strings);
+    stringsCopy[1] = "b";
+    REQUIRE(stringsCopy != strings);
+}
+
+TEST_CASE("Array arithmetic") {
+    Array<double, 4> a = Array<double, 4>::generate([](size_t i) { return (double)i; });
+    Array<double, 4> b(2);
+
+    REQUIRE(a.sum() == 6);
+    REQUIRE(a.min() == 0);
+    REQUIRE(a.max() == 3);
+    REQUIRE(a.dot(b) == 12);
+    REQUIRE(a.find(2) == a.begin() + 2);
+    REQUIRE(a.occurrences(7) == 0);
+
+    Array<double, 4> result = a * b - 1.0;
+    REQUIRE(result == Array<double, 4>::generate([](size_t i) { return 2.0 * i - 1; }));
+    result = result / b;
+    REQUIRE(result[3] == 2.5);
+
+    a.axpy(0.5, b);
+    REQUIRE(a[0] == 1);
+}
@@ -0,0 +1,49 @@
+#include "catch.hpp"
+#include "types/Checksum.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+TEST_CASE("CRC-32C") {
+    SECTION("tables") {
+        static_assert(crc32cTables[0][0] == 0);
+        static_assert(crc32cTables[0][1] == 0xF26B8303u);
+        static_assert(crc32cTables[0][128] == Crc32cPolynomial);
+    }
+
+    SECTION("known checksums") {
+        std::string digits = "123456789";
+        REQUIRE(crc32c(digits.data(), digits.size()) == 0xE3069283u);
+        REQUIRE(crc32cSoftware(digits.data(), digits.size()) == 0xE3069283u);
+        REQUIRE(crc32c(digits.data(), 0) == 0);
+
+        // RFC 3720, B.4
+        std::vector<unsigned char> zeros(32, 0), ones(32, 0xFF), ascending(32);
+        for (size_t i = 0; i < 32; i++) ascending[i] = (unsigned char)i;
+        REQUIRE(crc32c(zeros.data(), 32) == 0x8A9136AAu);
+        REQUIRE(crc32c(ones.data(), 32) == 0x62A8AB43u);
+        REQUIRE(crc32c(ascending.data(), 32) == 0x46DD794Eu);
+    }
+
+    SECTION("software and hardware agree, at any alignment and size") {
+        std::vector<unsigned char> bytes(1000);
+        uint32_t seed = 7;
+        for (unsigned char& byte: bytes) byte = (unsigned char)((seed = seed * 1103515245u + 12345u) >> 16);
+        for (size_t offset = 0; offset < 8; offset++) {
+            for (size_t size: {0, 1, 7, 8, 9, 63, 64, 500, 991}) {
+                REQUIRE(crc32c(bytes.data() + offset, size) == crc32cSoftware(bytes.data() + offset, size));
+            }
+        }
+    }
+
+    SECTION("piece by piece") {
+        std::string text = "The quick brown fox jumps over the lazy dog";
+        uint32_t whole = crc32c(text.data(), text.size());
+        uint32_t pieces = crc32c(text.data(), 10);
+        pieces = crc32c(text.data() + 10, 13, pieces);
+        pieces = crc32c(text.data() + 23, text.size() - 23, pieces);
+        REQUIRE(pieces == whole);
+        REQUIRE(crc32cSoftware(text.data() + 10, text.size() - 10, crc32cSoftware(text.data(), 10)) == whole);
+    }
+}
@@ -0,0 +1,85 @@
+#include "catch.hpp"
+#include "types/ConcurrentQueue.hpp"
+#include "types/Vector.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+TEST_CASE("ConcurrentQueue single threaded") {
+    ConcurrentQueue<std::string> queue;
+    std::string value;
+
+    REQUIRE(queue.empty());
+    REQUIRE(!queue.pop(value));
+
+    queue.push("a");
+    std::string b = "b";
+    queue.push(b);
+    queue.push(std::string(100, 'c'));
+    REQUIRE(!queue.empty());
+
+    REQUIRE(queue.pop(value));
+    REQUIRE(value == "a");
+    REQUIRE(queue.pop(value));
+    REQUIRE(value == "b");
+
+    queue.push("d");
+    REQUIRE(queue.pop(value));
+    REQUIRE(value == std::string(100, 'c'));
+    REQUIRE(queue.pop(value));
+    REQUIRE(value == "d");
+    REQUIRE(!queue.pop(value));
+    REQUIRE(queue.empty());
+
+    // Destroying a non empty queue releases its values
+    queue.push("e");
+    queue.push("f");
+}
+
+TEST_CASE("ConcurrentQueue multiple producers and consumers") {
+    const int producers = 4;
+    const int consumers = 4;
+    const int perProducer = 20000;
+
+    ConcurrentQueue<long> queue;
+    std::atomic<int> consumed{0};
+    Vector<Vector<long>> received(consumers, Vector<long>());
+
+    Vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.push(std::thread([&queue, p]() {
+            for (long i = 0; i < perProducer; i++) queue.push(p * perProducer + i);
+        }));
+    }
+    for (int c = 0; c < consumers; c++) {
+        threads.push(std::thread([&queue, &consumed, &received, c]() {
+            long value;
+            while (consumed.load() < producers * perProducer) {
+                if (queue.pop(value)) {
+                    received[c].push(value);
+                    consumed++;
+                }
+            }
+        }));
+    }
+    for (auto& thread: threads) thread.join();
+
+    Vector<int> seen(producers * perProducer, 0);
+    bool ordered = true;
+    for (auto& values: received) {
+        Vector<long> lastPerProducer(producers, -1);
+        for (long value: values) {
+            seen[value]++;
+            // Values of a same producer come out in the order they were pushed
+            ordered = ordered && value > lastPerProducer[value / perProducer];
+            lastPerProducer[value / perProducer] = value;
+        }
+    }
+
+    bool once = true;
+    for (int count: seen) once = once && count == 1;
+    REQUIRE(once);
+    REQUIRE(ordered);
+    REQUIRE(queue.empty());
+}
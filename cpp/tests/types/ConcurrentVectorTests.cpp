@@ -0,0 +1,105 @@
+#include "catch.hpp"
+#include "types/ConcurrentVector.hpp"
+#include "types/Vector.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+
+TEST_CASE("ConcurrentVector single threaded") {
+    ConcurrentVector<std::string, 4> vect;
+    REQUIRE(vect.empty());
+    REQUIRE_THROWS_AS(vect[0], IllegalIndexException);
+
+    for (int i = 0; i < 1000; i++) REQUIRE(vect.push(std::to_string(i)) == (size_t)i);
+    REQUIRE(vect.size() == 1000);
+    REQUIRE(vect[0] == "0");
+    REQUIRE(vect.at(999) == "999");
+    REQUIRE_THROWS_AS(vect.at(1000), IllegalIndexException);
+
+    // Elements never move
+    const std::string* first = &vect[0];
+    const std::string* last = &vect[999];
+    for (int i = 0; i < 10000; i++) vect.emplace(3, 'x');
+    REQUIRE(&vect[0] == first);
+    REQUIRE(&vect[999] == last);
+    REQUIRE(vect[10999] == "xxx");
+
+    std::string values[] = {"a", "b"};
+    REQUIRE(vect.append(values, values + 2) == 11000);
+    REQUIRE(vect.size() == 11002);
+    REQUIRE(vect[11001] == "b");
+
+    size_t count = 0;
+    for (const std::string& value: vect) count += !value.empty();
+    REQUIRE(count == 11002);
+    REQUIRE(std::find(vect.begin(), vect.end(), "500") - vect.begin() == 500);
+
+    vect.clear();
+    REQUIRE(vect.empty());
+    vect.push("again");
+    REQUIRE(vect.size() == 1);
+    REQUIRE(vect[0] == "again");
+}
+
+TEST_CASE("ConcurrentVector concurrent pushes") {
+    const int threadCount = 4;
+    const int perThread = 50000;
+    ConcurrentVector<long, 16> vect;
+
+    Vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.push(std::thread([&vect, t]() {
+            for (long i = 0; i < perThread; i++) {
+                if (i % 100 == 0) {
+                    long batch[3] = {t * perThread + i, t * perThread + i + 1, t * perThread + i + 2};
+                    vect.append(batch, batch + 3);
+                    i += 2;
+                } else {
+                    vect.push(t * perThread + i);
+                }
+            }
+        }));
+    }
+    for (std::thread& thread: threads) thread.join();
+
+    REQUIRE(vect.size() == threadCount * perThread);
+    Vector<long> values;
+    for (long value: vect) values.push(value);
+    std::sort(values.begin(), values.end());
+    bool all = true;
+    for (long i = 0; i < threadCount * perThread; i++) all = all && values[i] == i;
+    REQUIRE(all);
+}
+
+TEST_CASE("ConcurrentVector readers see complete elements") {
+    const int writers = 3;
+    const int perWriter = 20000;
+    ConcurrentVector<std::string> vect;
+    std::atomic<bool> done{false};
+    std::atomic<bool> consistent{true};
+
+    std::thread reader([&]() {
+        while (!done.load()) {
+            size_t size = vect.size();
+            for (size_t i = size > 100 ? size - 100 : 0; i < size; i++) {
+                const std::string& value = vect[i];
+                // Every element is a repeated digit
+                if (value.size() != 20 || value.find_first_not_of(value[0]) != std::string::npos) consistent = false;
+            }
+        }
+    });
+    Vector<std::thread> threads;
+    for (int w = 0; w < writers; w++) {
+        threads.push(std::thread([&vect, w]() {
+            for (int i = 0; i < perWriter; i++) vect.emplace(20, (char)('0' + (w * 3 + i) % 10));
+        }));
+    }
+    for (std::thread& thread: threads) thread.join();
+    done = true;
+    reader.join();
+
+    REQUIRE(consistent.load());
+    REQUIRE(vect.size() == writers * perWriter);
+}
@@ -0,0 +1,174 @@
+#include "catch.hpp"
+#include "types/DoublyLinkedList.hpp"
+
+#include <memory>
+#include <string>
+
+TEST_CASE("DoublyLinkedList elements getter and setters") {
+    DoublyLinkedList<int> list;
+    for (int i = 0; i < 5; i++) list.push(0);
+
+    for (int i = 0; i < 5; i++) list[i] = i;
+    for (int i = 0; i < 5; i++) REQUIRE(list[i] == i);
+    REQUIRE_THROWS_AS(list[5], IllegalIndexException);
+
+    REQUIRE(list.first() == 0);
+    REQUIRE(list.last() == 4);
+}
+
+TEST_CASE("DoublyLinkedListNode constructors") {
+    DoublyLinkedListNode<std::string> first("a");
+    DoublyLinkedListNode<std::string> last("b", &first);
+    REQUIRE(first.previous == nullptr);
+    REQUIRE(first.next == nullptr);
+    REQUIRE(last.previous == &first);
+    REQUIRE(first.value + last.value == "ab");
+
+    DoublyLinkedListNode<std::string> inPlace(std::in_place, &first, &last, 3, 'c');
+    REQUIRE(inPlace.value == "ccc");
+    REQUIRE(inPlace.previous == &first);
+    REQUIRE(inPlace.next == &last);
+}
+
+TEST_CASE("DoublyLinkedList instantiation") {
+    DoublyLinkedList<std::string> list;
+    list.push("a");
+    list.push("b");
+
+    SECTION("DoublyLinkedList::DoublyLinkedList()") {
+        DoublyLinkedList<int> empty;
+        REQUIRE(empty.empty());
+        REQUIRE(empty.size() == 0);
+        REQUIRE_THROWS_AS(empty.first(), IllegalAccessException);
+    }
+
+    SECTION("copy") {
+        DoublyLinkedList<std::string> copy(list);
+        REQUIRE(copy == list);
+
+        DoublyLinkedList<std::string> assigned;
+        assigned.push("c");
+        assigned = (const DoublyLinkedList<std::string>&)list;
+        REQUIRE(assigned == list);
+    }
+
+    SECTION("move") {
+        DoublyLinkedList<std::string> copy(list);
+        DoublyLinkedList<std::string> moved(std::move(copy));
+        REQUIRE(moved == list);
+        REQUIRE(copy.empty());
+
+        DoublyLinkedList<std::string> assigned;
+        assigned = std::move(moved);
+        REQUIRE(assigned == list);
+        REQUIRE(moved.empty());
+    }
+}
+
+TEST_CASE("DoublyLinkedList push/pop at both ends") {
+    DoublyLinkedList<int> list;
+    list.push(1);
+    list.push(2);
+    list.pushFront(0);
+
+    REQUIRE(list.size() == 3);
+    REQUIRE(list[0] == 0);
+    REQUIRE(list[2] == 2);
+
+    list.pop();
+    REQUIRE(list.last() == 1);
+    list.popFront();
+    REQUIRE(list.first() == 1);
+    REQUIRE(list.size() == 1);
+
+    list.pop();
+    REQUIRE(list.empty());
+    list.pop();
+    list.popFront();
+    REQUIRE(list.empty());
+
+    list.pushFront(3);
+    REQUIRE(list.first() == 3);
+    REQUIRE(list.last() == 3);
+}
+
+TEST_CASE("DoublyLinkedList insert/erase functions") {
+    DoublyLinkedList<int> list;
+    list.push(0);
+    list.push(2);
+
+    SECTION("by index") {
+        list.insertBefore(1, 1);
+        list.insertAfter(2, 3);
+        list.insertBefore(4, 4);
+        REQUIRE(list.size() == 5);
+        for (int i = 0; i < 5; i++) REQUIRE(list[i] == i);
+
+        list.erase(0);
+        list.erase(3);
+        list.erase(1);
+        REQUIRE(list.size() == 2);
+        REQUIRE(list[0] == 1);
+        REQUIRE(list[1] == 3);
+
+        REQUIRE_THROWS_AS(list.insertBefore(3, 0), IllegalIndexException);
+        REQUIRE_THROWS_AS(list.insertAfter(2, 0), IllegalIndexException);
+        REQUIRE_THROWS_AS(list.erase(2), IllegalIndexException);
+    }
+
+    SECTION("by iterator") {
+        auto it = list.begin();
+        ++it;
+        auto inserted = list.insertBefore(it, 1);
+        REQUIRE(*inserted == 1);
+        list.insertBefore(list.end(), 3);
+        REQUIRE(list.size() == 4);
+        for (int i = 0; i < 4; i++) REQUIRE(list[i] == i);
+
+        auto next = list.erase(inserted);
+        REQUIRE(*next == 2);
+        next = list.erase(list.begin());
+        REQUIRE(*next == 2);
+        REQUIRE(list.size() == 2);
+        REQUIRE(list.first() == 2);
+        REQUIRE(list.last() == 3);
+
+        REQUIRE_THROWS_AS(list.erase(list.end()), IllegalAccessException);
+    }
+}
+
+TEST_CASE("DoublyLinkedList Iterators") {
+    DoublyLinkedList<int> list;
+    list.push(1);
+    list.push(2);
+    list.push(3);
+
+    int result = 0;
+    for(int& value: list) {
+        result += value;
+    }
+    REQUIRE(result == 6);
+
+    auto it = list.begin();
+    ++it;
+    ++it;
+    --it;
+    REQUIRE(*it == 2);
+}
+
+TEST_CASE("DoublyLinkedList constructs elements in place") {
+    DoublyLinkedList<std::unique_ptr<int>> pointers;
+    pointers.push(std::make_unique<int>(2));
+    pointers.pushFront(std::make_unique<int>(0));
+    pointers.emplaceBefore(1, new int(1));
+    pointers.emplace(new int(4));
+    pointers.emplaceAfter(2, new int(3));
+    pointers.insertBefore(pointers.end(), std::make_unique<int>(5));
+    REQUIRE(pointers.size() == 6);
+    for (int i = 0; i < 6; i++) REQUIRE(*pointers[i] == i);
+
+    DoublyLinkedList<std::string> strings;
+    REQUIRE(strings.emplace(3, 'a') == "aaa");
+    REQUIRE(strings.emplaceFront("b") == "b");
+    REQUIRE(strings[1] == "aaa");
+}
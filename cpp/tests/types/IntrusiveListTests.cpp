@@ -0,0 +1,155 @@
+#include "catch.hpp"
+#include "types/IntrusiveList.hpp"
+
+#include <string>
+
+namespace {
+    struct Entry {
+        std::string key;
+        IntrusiveListHook lru;
+        IntrusiveListHook expiry;
+
+        Entry(std::string key) : key(std::move(key)) {}
+    };
+
+    typedef IntrusiveList<Entry, &Entry::lru> LruList;
+    typedef IntrusiveList<Entry, &Entry::expiry> ExpiryList;
+}
+
+TEST_CASE("IntrusiveList push/pop") {
+    Entry a("a"), b("b"), c("c");
+    LruList list;
+
+    REQUIRE(list.empty());
+    list.push(b);
+    list.push(c);
+    list.pushFront(a);
+
+    REQUIRE(list.size() == 3);
+    REQUIRE(&list.first() == &a);
+    REQUIRE(&list.last() == &c);
+    REQUIRE(&list[1] == &b);
+    REQUIRE_THROWS_AS(list[3], IllegalIndexException);
+    REQUIRE(a.lru.linked());
+
+    list.pop();
+    REQUIRE(!c.lru.linked());
+    REQUIRE(&list.last() == &b);
+    list.popFront();
+    REQUIRE(&list.first() == &b);
+    REQUIRE(list.size() == 1);
+
+    list.clear();
+    REQUIRE(list.empty());
+    REQUIRE(!b.lru.linked());
+    REQUIRE_THROWS_AS(list.first(), IllegalAccessException);
+    REQUIRE_THROWS_AS(list.erase(b), IllegalAccessException);
+    REQUIRE(list.empty());
+}
+
+TEST_CASE("IntrusiveList elements in several lists") {
+    Entry a("a"), b("b"), c("c");
+    LruList lru;
+    ExpiryList expiry;
+
+    lru.push(a);
+    lru.push(b);
+    lru.push(c);
+    expiry.push(c);
+    expiry.push(a);
+
+    SECTION("an element can only be linked once per hook") {
+        REQUIRE_THROWS_AS(lru.push(a), IllegalAccessException);
+    }
+
+    SECTION("LRU usage: touching moves an element to the back") {
+        lru.erase(a);
+        lru.push(a);
+        REQUIRE(&lru.first() == &b);
+        REQUIRE(&lru.last() == &a);
+        REQUIRE(&expiry.last() == &a);
+    }
+
+    SECTION("erase through iterators") {
+        auto it = lru.begin();
+        ++it;
+        auto next = lru.erase(it);
+        REQUIRE(&*next == &c);
+        REQUIRE(next->key == "c");
+        REQUIRE(lru.size() == 2);
+
+        expiry.erase(expiry.begin());
+        REQUIRE(&expiry.first() == &a);
+    }
+
+    SECTION("insertBefore") {
+        Entry d("d");
+        auto it = lru.begin();
+        ++it;
+        lru.insertBefore(it, d);
+        REQUIRE(&lru[1] == &d);
+        REQUIRE(lru.size() == 4);
+        lru.erase(d);
+    }
+
+    SECTION("copies of an element are not linked") {
+        Entry copy = a;
+        REQUIRE(!copy.lru.linked());
+        REQUIRE(copy.key == "a");
+    }
+
+    expiry.clear();
+    lru.clear();
+}
+
+TEST_CASE("IntrusiveList move and swap") {
+    Entry a("a"), b("b");
+    LruList list;
+    list.push(a);
+    list.push(b);
+
+    LruList moved(std::move(list));
+    REQUIRE(list.empty());
+    REQUIRE(moved.size() == 2);
+    REQUIRE(&moved.first() == &a);
+
+    LruList other;
+    other.swap(moved);
+    REQUIRE(moved.empty());
+    REQUIRE(&other.last() == &b);
+
+    other.pop();
+    other.push(b);
+    REQUIRE(&other.last() == &b);
+
+    std::string keys;
+    for (Entry& entry: other) keys += entry.key;
+    REQUIRE(keys == "ab");
+}
+
+namespace {
+    // Not standard layout, the hook comes after the vtable pointer and a large member
+    struct Task {
+        char payload[4096];
+        IntrusiveListHook hook;
+        int id;
+
+        Task(int id) : id(id) {}
+        virtual ~Task() {}
+    };
+}
+
+TEST_CASE("IntrusiveList of elements that are not standard layout") {
+    Task first(1), second(2);
+    IntrusiveList<Task, &Task::hook> tasks;
+    tasks.push(first);
+    tasks.push(second);
+    int sum = 0;
+    for (Task& task: tasks) sum += task.id;
+    REQUIRE(sum == 3);
+    REQUIRE(&tasks.last() == &second);
+
+    IntrusiveList<Task, &Task::hook> moved(std::move(tasks));
+    REQUIRE(moved.begin()->id == 1);
+    moved.clear();
+}
@@ -1,5 +1,9 @@
 #include "catch.hpp"
 #include "types/LinkedList.hpp"
+#include "types/Vector.hpp"
+
+#include <cstdlib>
+#include <string>
 
 TEST_CASE("LinkedList elements getter and setters") {
     LinkedList<int> list;
@@ -22,6 +26,18 @@ TEST_CASE("LinkedList elements getter and setters") {
     REQUIRE_THROWS_AS(list[3], IllegalIndexException);
 }
 
+TEST_CASE("LinkedListNode constructors") {
+    LinkedListNode<std::string> last("b");
+    LinkedListNode<std::string> first("a", &last);
+    REQUIRE(first.next == &last);
+    REQUIRE(last.next == nullptr);
+    REQUIRE(first.value + last.value == "ab");
+
+    LinkedListNode<std::string> inPlace(std::in_place, &first, 3, 'c');
+    REQUIRE(inPlace.value == "ccc");
+    REQUIRE(inPlace.next == &first);
+}
+
 TEST_CASE("LinkedList instantiation") {
     SECTION("LinkedList::LinkedList()") {
         LinkedList<int> list;
@@ -94,6 +110,29 @@ TEST_CASE("LinkedList instantiation") {
             REQUIRE(list.empty());
             REQUIRE_THROWS_AS(list[0], IllegalIndexException);          
         }
+
+        SECTION("LinkedList& operator=(LinkedList<T>&& other) on a non empty list") {
+            LinkedList<int> moved;
+            moved.push(5);
+            int* first = &list[0];
+            moved = std::move(list);
+
+            REQUIRE(&moved[0] == first);
+            REQUIRE(moved.size() == 2);
+            REQUIRE(moved[1] == 2);
+            REQUIRE(list.empty());
+        }
+
+        SECTION("void swap(LinkedList<T>& other)") {
+            LinkedList<int> other;
+            other.push(5);
+            list.swap(other);
+
+            REQUIRE(list.size() == 1);
+            REQUIRE(list[0] == 5);
+            REQUIRE(other.size() == 2);
+            REQUIRE(other[0] == 1);
+        }
     }
 }
 
@@ -186,6 +225,17 @@ TEST_CASE("LinkedList insert/erase functions") {
             REQUIRE(list[1] == 50);
         }
 
+        SECTION("at 0 on a non empty list") {
+            LinkedList<int> list;
+            list.push(1);
+            list.push(2);
+            list.insertBefore(0, 0);
+            REQUIRE(list.size() == 3);
+            REQUIRE(list[0] == 0);
+            REQUIRE(list[1] == 1);
+            REQUIRE(list[2] == 2);
+        }
+
         SECTION("Valid standard case") {
             LinkedList<int> list;
             list.push(1);
@@ -266,4 +316,403 @@ TEST_CASE("LinkedList Iterators") {
     }
 
     REQUIRE(result == 3);
-}
\ No newline at end of file
+}
+
+TEST_CASE("LinkedList tail tracking") {
+    LinkedList<int> list;
+    list.push(0);
+    list.push(1);
+
+    SECTION("push after insertAfter on the last element") {
+        list.insertAfter(1, 2);
+        list.push(3);
+        REQUIRE(list.size() == 4);
+        REQUIRE(list[2] == 2);
+        REQUIRE(list[3] == 3);
+    }
+
+    SECTION("push after erasing the last element") {
+        list.erase(1);
+        list.push(2);
+        REQUIRE(list.size() == 2);
+        REQUIRE(list[0] == 0);
+        REQUIRE(list[1] == 2);
+
+        list.erase(0);
+        list.erase(0);
+        list.push(3);
+        REQUIRE(list.size() == 1);
+        REQUIRE(list[0] == 3);
+    }
+
+    SECTION("push after pop") {
+        list.pop();
+        list.push(2);
+        REQUIRE(list.size() == 2);
+        REQUIRE(list[1] == 2);
+    }
+
+    SECTION("large lists") {
+        LinkedList<int> large;
+        for (int i = 0; i < 1000000; i++) large.push(i);
+        REQUIRE(large.size() == 1000000);
+        REQUIRE(large[999999] == 999999);
+
+        LinkedList<int> copy(large);
+        REQUIRE(copy.size() == 1000000);
+        REQUIRE(copy[999999] == 999999);
+    }
+}
+
+TEST_CASE("LinkedList relinking functions") {
+    LinkedList<int> list;
+    list.push(0);
+    list.push(1);
+
+    LinkedList<int> other;
+    other.push(2);
+    other.push(3);
+
+    SECTION("void append(LinkedList<T>&& other)") {
+        int* moved = &other[0];
+        list.append(std::move(other));
+
+        REQUIRE(list.size() == 4);
+        REQUIRE(&list[2] == moved);
+        REQUIRE(list[3] == 3);
+        REQUIRE(other.empty());
+
+        list.push(4);
+        REQUIRE(list[4] == 4);
+
+        LinkedList<int> empty;
+        empty.append(std::move(list));
+        REQUIRE(empty.size() == 5);
+        REQUIRE(list.empty());
+    }
+
+    SECTION("void splice(size_t at, LinkedList<T>& other)") {
+        SECTION("at 0") {
+            list.splice(0, other);
+            REQUIRE(list.size() == 4);
+            REQUIRE(list[0] == 2);
+            REQUIRE(list[1] == 3);
+            REQUIRE(list[2] == 0);
+            REQUIRE(other.empty());
+        }
+
+        SECTION("in the middle") {
+            list.splice(1, other);
+            REQUIRE(list.size() == 4);
+            REQUIRE(list[0] == 0);
+            REQUIRE(list[1] == 2);
+            REQUIRE(list[2] == 3);
+            REQUIRE(list[3] == 1);
+
+            list.push(4);
+            REQUIRE(list[4] == 4);
+        }
+
+        SECTION("at size()") {
+            list.splice(2, other);
+            list.push(4);
+            REQUIRE(list.size() == 5);
+            REQUIRE(list[3] == 3);
+            REQUIRE(list[4] == 4);
+        }
+
+        SECTION("the other list stays usable") {
+            list.splice(1, other);
+            other.push(5);
+            REQUIRE(other.size() == 1);
+            REQUIRE(other[0] == 5);
+        }
+
+        SECTION("throws for at > size()") {
+            REQUIRE_THROWS_AS(list.splice(3, other), IllegalIndexException);
+            REQUIRE(other.size() == 2);
+        }
+    }
+
+    SECTION("LinkedList<T> splitAt(size_t at)") {
+        list.append(std::move(other));
+
+        SECTION("in the middle") {
+            LinkedList<int> second = list.splitAt(1);
+            REQUIRE(list.size() == 1);
+            REQUIRE(list[0] == 0);
+            REQUIRE(second.size() == 3);
+            REQUIRE(second[0] == 1);
+            REQUIRE(second[2] == 3);
+
+            list.push(4);
+            second.push(5);
+            REQUIRE(list[1] == 4);
+            REQUIRE(second[3] == 5);
+
+            list.clear();
+            second.erase(0);
+            REQUIRE(second[0] == 2);
+        }
+
+        SECTION("at 0 and size()") {
+            LinkedList<int> all = list.splitAt(0);
+            REQUIRE(list.empty());
+            REQUIRE(all.size() == 4);
+
+            LinkedList<int> none = all.splitAt(4);
+            REQUIRE(none.empty());
+            REQUIRE(all.size() == 4);
+            REQUIRE_THROWS_AS(all.splitAt(5), IllegalIndexException);
+        }
+
+        SECTION("split halves merged back") {
+            LinkedList<int> second = list.splitAt(2);
+            second.append(std::move(list));
+            REQUIRE(second.size() == 4);
+            REQUIRE(second[0] == 2);
+            REQUIRE(second[3] == 1);
+        }
+    }
+}
+
+TEST_CASE("LinkedList destruction of very long lists") {
+    LinkedList<int, HeapNodeAllocator<LinkedListNode<int>>> heap;
+    LinkedList<std::string> pooled;
+    for (int i = 0; i < 3000000; i++) heap.push(i);
+    for (int i = 0; i < 1000000; i++) pooled.push("a");
+    heap.clear();
+    REQUIRE(heap.empty());
+}
+
+
+TEST_CASE("LinkedList positional accesses") {
+    SECTION("indexed loops are linear") {
+        LinkedList<int> list;
+        for (int i = 0; i < 200000; i++) list.push(i);
+
+        long sum = 0;
+        for (size_t i = 0; i < list.size(); i++) sum += list[i];
+        REQUIRE(sum == 199999L * 200000L / 2);
+
+        const LinkedList<int>& clist = list;
+        bool ordered = true;
+        for (size_t i = 0; i < clist.size(); i++) ordered = ordered && clist[i] == (int)i;
+        REQUIRE(ordered);
+    }
+
+    SECTION("random operations behave like a vector") {
+        LinkedList<int> list;
+        Vector<int> expected;
+        std::srand(7);
+        for (int i = 0; i < 5000; i++) {
+            int operation = std::rand() % 6;
+            size_t at = expected.empty() ? 0 : std::rand() % expected.size();
+            if (operation == 0 || expected.size() < 2) {
+                list.push(i);
+                expected.push(i);
+            } else if (operation == 1) {
+                list.insertBefore(at, i);
+                expected.insert(at, i);
+            } else if (operation == 2) {
+                list.insertAfter(at, i);
+                if (at + 1 == expected.size()) expected.push(i); else expected.insert(at + 1, i);
+            } else if (operation == 3) {
+                list.erase(at);
+                expected.erase(at);
+            } else if (operation == 4) {
+                list.pop();
+                expected.pop();
+            } else {
+                REQUIRE(list[at] == expected[at]);
+            }
+        }
+
+        REQUIRE(list.size() == expected.size());
+        bool same = true;
+        for (size_t i = 0; i < expected.size(); i++) same = same && list[i] == expected[i];
+        REQUIRE(same);
+    }
+
+    SECTION("a list spliced into another keeps working on its own") {
+        LinkedList<std::string> merged;
+        merged.push("a");
+        LinkedList<std::string> worker;
+        worker.push("b");
+        worker.push("c");
+        merged.splice(1, worker);
+
+        const std::string* erased = &merged[2];
+        merged.erase(2);
+        worker.push("d");
+        REQUIRE(&worker[0] != erased);
+        merged.push("e");
+        REQUIRE(merged.size() == 3);
+        REQUIRE(merged[1] == "b");
+        REQUIRE(merged[2] == "e");
+        REQUIRE(worker.size() == 1);
+        REQUIRE(worker[0] == "d");
+    }
+
+    SECTION("relinking keeps positions consistent") {
+        LinkedList<int> list;
+        for (int i = 0; i < 10; i++) list.push(i);
+        REQUIRE(list[5] == 5);
+
+        LinkedList<int> other;
+        other.push(-2);
+        other.push(-1);
+        list.splice(0, other);
+        REQUIRE(list[7] == 5);
+        REQUIRE(other.empty());
+
+        LinkedList<int> second = list.splitAt(6);
+        REQUIRE(list[5] == 3);
+        REQUIRE(second[1] == 5);
+        REQUIRE_THROWS_AS(list[6], IllegalIndexException);
+
+        list.erase(0);
+        REQUIRE(list[0] == -1);
+        REQUIRE(list[4] == 3);
+    }
+
+    SECTION("self assignment") {
+        LinkedList<int> list;
+        list.push(1);
+        LinkedList<int>& same = list;
+        list = same;
+        REQUIRE(list.size() == 1);
+        REQUIRE(list[0] == 1);
+    }
+}
+
+
+TEST_CASE("LinkedList sort") {
+    SECTION("small lists") {
+        LinkedList<int> list;
+        list.sort();
+        REQUIRE(list.empty());
+
+        list.push(3);
+        list.sort();
+        REQUIRE(list[0] == 3);
+
+        list.push(1);
+        list.push(2);
+        list.sort();
+        LinkedList<int> expected;
+        for (int i = 1; i <= 3; i++) expected.push(i);
+        REQUIRE(list == expected);
+
+        list.sort(std::greater<int>());
+        REQUIRE(list[0] == 3);
+        REQUIRE(list[2] == 1);
+    }
+
+    SECTION("random values, keeping equal ones in order") {
+        LinkedList<std::pair<int, int>> list;
+        std::srand(11);
+        for (int i = 0; i < 10007; i++) list.push({std::rand() % 100, i});
+
+        list.sort([](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; });
+
+        REQUIRE(list.size() == 10007);
+        bool sorted = true;
+        std::pair<int, int> previous(-1, -1);
+        for (auto& value: list) {
+            sorted = sorted && (previous.first < value.first || (previous.first == value.first && previous.second < value.second));
+            previous = value;
+        }
+        REQUIRE(sorted);
+
+        // The tail is still tracked
+        list.push({1000, 0});
+        REQUIRE(list[10007].first == 1000);
+        list.pop();
+        REQUIRE(list[10006] == previous);
+    }
+
+    SECTION("long lists") {
+        LinkedList<int> list;
+        for (int i = 3000000; i > 0; i--) list.push(i);
+        list.sort();
+        bool sorted = true;
+        int expected = 1;
+        for (int value: list) sorted = sorted && value == expected++;
+        REQUIRE(sorted);
+    }
+}
+
+
+namespace {
+    // Counts how values reach the list
+    struct Payload {
+        static int copies;
+        static int moves;
+        std::string text;
+        int tag;
+
+        Payload(std::string text, int tag = 0) : text(std::move(text)), tag(tag) {}
+        Payload(const Payload& other) : text(other.text), tag(other.tag) { copies++; }
+        Payload(Payload&& other) noexcept : text(std::move(other.text)), tag(other.tag) { moves++; }
+        Payload& operator=(const Payload&) = default;
+        Payload& operator=(Payload&&) = default;
+        bool operator!=(const Payload& other) const { return text != other.text || tag != other.tag; }
+    };
+
+    int Payload::copies = 0;
+    int Payload::moves = 0;
+}
+
+TEST_CASE("LinkedList move and emplace insertions") {
+    Payload::copies = 0;
+    Payload::moves = 0;
+    LinkedList<Payload> list;
+
+    SECTION("copies happen once, moves never copy") {
+        Payload value(std::string(100, 'a'));
+        list.push(value);
+        REQUIRE(Payload::copies == 1);
+        REQUIRE(Payload::moves == 0);
+
+        list.push(Payload("b"));
+        list.insertBefore(0, Payload("c"));
+        list.insertAfter(0, Payload("d"));
+        REQUIRE(Payload::copies == 1);
+        REQUIRE(Payload::moves == 3);
+        REQUIRE(value.text == std::string(100, 'a'));
+    }
+
+    SECTION("emplacement constructs in place") {
+        Payload& last = list.emplace("b", 2);
+        REQUIRE(last.tag == 2);
+        list.emplaceBefore(0, "a", 1);
+        list.emplaceAfter(1, "d", 4);
+        Payload& inserted = list.emplaceBefore(2, "c", 3);
+        inserted.tag = 30;
+        REQUIRE(Payload::copies == 0);
+        REQUIRE(Payload::moves == 0);
+
+        REQUIRE(list.size() == 4);
+        REQUIRE(list[0].text == "a");
+        REQUIRE(list[1].text == "b");
+        REQUIRE(list[2].tag == 30);
+        REQUIRE(list[3].text == "d");
+        REQUIRE_THROWS_AS(list.emplaceAfter(4, "e"), IllegalIndexException);
+
+        // The tail is still tracked
+        list.emplace("e", 5);
+        list.pop();
+        REQUIRE(list[3].tag == 4);
+    }
+
+    SECTION("emplacing from an element of the list") {
+        list.emplace("a", 1);
+        list.emplace("b", 2);
+        list.emplaceBefore(0, list[1]);
+        list.emplace(std::move(list[0]));
+        REQUIRE(list.size() == 4);
+        REQUIRE(list[3].text == "b");
+        REQUIRE(list[0].text.empty());
+    }
+}
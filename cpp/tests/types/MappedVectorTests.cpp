@@ -0,0 +1,170 @@
+#include "catch.hpp"
+#include "types/MappedVector.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+    // Removes the file when going out of scope
+    struct TemporaryFile {
+        std::string path;
+
+        TemporaryFile(const std::string& name) : path((std::filesystem::temp_directory_path() / ("algorithmic-" + std::to_string(getpid()) + "-" + name)).string()) {
+            std::remove(path.c_str());
+        }
+
+        ~TemporaryFile() {
+            std::remove(path.c_str());
+        }
+    };
+
+    struct Point {
+        double x;
+        double y;
+    };
+}
+
+TEST_CASE("MappedVector creation and reopening") {
+    TemporaryFile file("reopen");
+
+    SECTION("empty file") {
+        {
+            MappedVector<int> vect(file.path);
+            REQUIRE(vect.empty());
+            REQUIRE(vect.path() == file.path);
+        }
+        MappedVector<int> vect(file.path);
+        REQUIRE(vect.size() == 0);
+    }
+
+    SECTION("elements persist") {
+        {
+            MappedVector<int> vect(file.path);
+            for (int i = 0; i < 100000; i++) vect.push(i);
+            REQUIRE(vect.size() == 100000);
+            REQUIRE(vect.capacity() >= 100000);
+        }
+        // The unused capacity was cut off
+        REQUIRE(std::filesystem::file_size(file.path) == 64 + 100000 * sizeof(int));
+
+        MappedVector<int> vect(file.path);
+        REQUIRE(vect.size() == 100000);
+        bool intact = true;
+        for (int i = 0; i < 100000; i++) intact = intact && vect[i] == i;
+        REQUIRE(intact);
+
+        vect.push(-1);
+        vect[0] = 42;
+        vect.sync();
+        MappedVector<int> reader(file.path, MappedAccess::ReadOnly);
+        REQUIRE(reader.size() == 100001);
+        REQUIRE(reader.first() == 42);
+        REQUIRE(reader.last() == -1);
+    }
+
+    SECTION("structures") {
+        {
+            MappedVector<Point> points(file.path);
+            points.push({1.5, 2.5});
+            points.push({-1, 0});
+        }
+        const MappedVector<Point> points(file.path, MappedAccess::ReadOnly);
+        REQUIRE(points.size() == 2);
+        REQUIRE(points[0].y == 2.5);
+        REQUIRE(points[1].x == -1);
+    }
+}
+
+TEST_CASE("MappedVector modifiers") {
+    TemporaryFile file("modifiers");
+    MappedVector<long> vect(file.path);
+
+    SECTION("resize, pop and clear") {
+        vect.resize(10, 7);
+        REQUIRE(vect.size() == 10);
+        REQUIRE(vect[9] == 7);
+        vect.pop();
+        REQUIRE(vect.size() == 9);
+        vect.resize(3);
+        REQUIRE(vect.size() == 3);
+        vect.clear();
+        REQUIRE(vect.empty());
+        REQUIRE_THROWS_AS(vect.pop(), IllegalIndexException);
+    }
+
+    SECTION("append, including from itself") {
+        long values[] = {1, 2, 3};
+        vect.append(values, values + 3);
+        vect.append(vect.begin(), vect.end());
+        REQUIRE(vect.size() == 6);
+        long sum = 0;
+        for (long value: vect) sum += value;
+        REQUIRE(sum == 12);
+    }
+
+    SECTION("reserve and fill") {
+        vect.reserve(1000);
+        REQUIRE(vect.capacity() == 1000);
+        vect.resize(500);
+        vect.fill(-1);
+        REQUIRE(vect[499] == -1);
+        vect.advise(AccessPattern::Sequential);
+        vect.resize(5000);
+        REQUIRE(vect[499] == -1);
+        REQUIRE(vect[4999] == 0);
+    }
+
+    SECTION("bounds") {
+        vect.push(1);
+        REQUIRE_THROWS_AS(vect[1], IllegalIndexException);
+        REQUIRE_THROWS_AS(vect.at(1), IllegalIndexException);
+    }
+
+    SECTION("move") {
+        vect.push(3);
+        MappedVector<long> other(std::move(vect));
+        REQUIRE(other.size() == 1);
+        REQUIRE(other[0] == 3);
+    }
+}
+
+TEST_CASE("MappedVector rejects files it did not write") {
+    TemporaryFile file("invalid");
+
+    SECTION("missing read only file") {
+        REQUIRE_THROWS_AS(MappedVector<int>(file.path, MappedAccess::ReadOnly), IOException);
+    }
+
+    SECTION("foreign file is left untouched") {
+        {
+            std::ofstream out(file.path);
+            out << std::string(100, 'x');
+        }
+        REQUIRE_THROWS_AS(MappedVector<int>(file.path), IOException);
+        REQUIRE(std::filesystem::file_size(file.path) == 100);
+    }
+
+    SECTION("other element type") {
+        {
+            MappedVector<int> ints(file.path);
+            ints.push(1);
+        }
+        REQUIRE_THROWS_AS(MappedVector<double>(file.path), IOException);
+        REQUIRE(MappedVector<unsigned>(file.path).size() == 1);
+    }
+
+    SECTION("read only vectors cannot be changed") {
+        {
+            MappedVector<int> ints(file.path);
+            ints.push(1);
+        }
+        MappedVector<int> ints(file.path, MappedAccess::ReadOnly);
+        REQUIRE_THROWS_AS(ints.push(2), IllegalAccessException);
+        REQUIRE_THROWS_AS(ints.resize(5), IllegalAccessException);
+        REQUIRE_THROWS_AS(ints.fill(0), IllegalAccessException);
+        REQUIRE(ints.size() == 1);
+        REQUIRE(ints[0] == 1);
+    }
+}
@@ -0,0 +1,123 @@
+#include "catch.hpp"
+#include "types/NodePool.hpp"
+#include "types/LinkedList.hpp"
+
+#include <string>
+
+namespace {
+    struct PoolNode {
+        long value;
+        PoolNode* next;
+    };
+}
+
+TEST_CASE("NodePool allocation") {
+    NodePool<PoolNode, 4> pool;
+
+    SECTION("nodes are carved out of contiguous chunks") {
+        PoolNode* first = pool.allocate();
+        PoolNode* second = pool.allocate();
+        REQUIRE((char*)second - (char*)first == sizeof(PoolNode));
+        pool.deallocate(first);
+        pool.deallocate(second);
+    }
+
+    SECTION("deallocated nodes are recycled first") {
+        PoolNode* first = pool.allocate();
+        pool.allocate();
+        pool.deallocate(first);
+        REQUIRE(pool.allocate() == first);
+    }
+
+    SECTION("allocates new chunks past NodesPerChunk nodes") {
+        PoolNode* nodes[10];
+        for (auto& node: nodes) {
+            node = pool.allocate();
+            node->value = 1;
+        }
+        for (size_t i = 0; i < 10; i++) {
+            for (size_t j = i + 1; j < 10; j++) REQUIRE(nodes[i] != nodes[j]);
+        }
+    }
+
+    SECTION("releases in bulk only while it is the sole owner of its chunks") {
+        REQUIRE(pool.releasesInBulk());
+        pool.allocate();
+        REQUIRE(pool.releasesInBulk());
+
+        NodePool<PoolNode, 4> shared = pool;
+        REQUIRE(!pool.releasesInBulk());
+        REQUIRE(!shared.releasesInBulk());
+
+        shared.release();
+        REQUIRE(pool.releasesInBulk());
+    }
+
+    SECTION("adopt merges the chunks of another pool") {
+        NodePool<PoolNode, 4> other;
+        PoolNode* node = other.allocate();
+        node->value = 42;
+        pool.allocate();
+
+        NodePool<PoolNode, 4> sharing = other;
+        pool.adopt(other);
+        REQUIRE(pool.releasesInBulk() == false);
+        REQUIRE(other.releasesInBulk());
+
+        sharing.release();
+        REQUIRE(pool.releasesInBulk());
+        REQUIRE(node->value == 42);
+
+        pool.deallocate(node);
+        REQUIRE(pool.allocate() == node);
+    }
+
+    SECTION("an adopted pool gets chunks of its own") {
+        NodePool<PoolNode, 4> other;
+        PoolNode* node = other.allocate();
+        pool.allocate();
+        pool.adopt(other);
+        REQUIRE(pool.releasesInBulk());
+
+        pool.deallocate(node);
+        REQUIRE(other.allocate() != node);
+        REQUIRE(other.releasesInBulk());
+        REQUIRE(pool.allocate() == node);
+    }
+}
+
+TEST_CASE("LinkedList node allocators") {
+    SECTION("pooled lists recycle erased nodes") {
+        LinkedList<int> list;
+        list.push(0);
+        list.push(1);
+        int* erased = &list[1];
+        list.erase(1);
+        list.push(2);
+        REQUIRE(&list[1] == erased);
+    }
+
+    SECTION("pooled lists of non trivial elements") {
+        LinkedList<std::string> list;
+        for (int i = 0; i < 2000; i++) list.push(std::string(32, 'a' + i % 26));
+        LinkedList<std::string> copy(list);
+        list.clear();
+        REQUIRE(list.empty());
+        REQUIRE(copy.size() == 2000);
+        REQUIRE(copy[27] == std::string(32, 'b'));
+    }
+
+    SECTION("heap allocated nodes") {
+        LinkedList<std::string, HeapNodeAllocator<LinkedListNode<std::string>>> list;
+        list.push("a");
+        list.push("b");
+        list.insertBefore(0, "c");
+        list.erase(1);
+        REQUIRE(list.size() == 2);
+        REQUIRE(list[0] == "c");
+        REQUIRE(list[1] == "b");
+        list.pop();
+        list.clear();
+        REQUIRE(list.empty());
+    }
+}
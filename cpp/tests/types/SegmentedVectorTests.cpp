@@ -0,0 +1,178 @@
+#include "catch.hpp"
+#include "types/SegmentedVector.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    struct Fragile {
+        int value;
+
+        Fragile(int value) : value(value) {
+            if (value < 0) throw std::runtime_error("negative value");
+        }
+    };
+}
+
+TEST_CASE("SegmentedVector constructors and copy/move semantics") {
+    SECTION("default") {
+        SegmentedVector<int> vect;
+        REQUIRE(vect.empty());
+        REQUIRE(vect.begin() == vect.end());
+    }
+
+    SECTION("copies") {
+        SegmentedVector<std::string, 4> vect(10, "a");
+        vect.pushFront("b");
+        SegmentedVector<std::string, 4> copy(vect);
+        REQUIRE(copy == vect);
+        copy[0] = "c";
+        REQUIRE(copy != vect);
+        copy = vect;
+        REQUIRE(copy == vect);
+        REQUIRE(copy.first() == "b");
+    }
+
+    SECTION("moves") {
+        SegmentedVector<int, 4> vect = {1, 2, 3, 4, 5};
+        const int* address = &vect[4];
+        SegmentedVector<int, 4> moved(std::move(vect));
+        REQUIRE(vect.empty());
+        REQUIRE(&moved[4] == address);
+        vect = std::move(moved);
+        REQUIRE(vect.size() == 5);
+        REQUIRE(&vect[4] == address);
+    }
+}
+
+TEST_CASE("SegmentedVector elements access") {
+    SegmentedVector<int, 8> vect;
+    for (int i = 0; i < 100; i++) vect.push(i);
+    for (int i = 1; i <= 100; i++) vect.pushFront(-i);
+
+    REQUIRE(vect.size() == 200);
+    REQUIRE(vect.first() == -100);
+    REQUIRE(vect.last() == 99);
+    bool ordered = true;
+    for (int i = 0; i < 200; i++) ordered = ordered && vect[i] == i - 100;
+    REQUIRE(ordered);
+    REQUIRE_THROWS_AS(vect[200], IllegalIndexException);
+    REQUIRE_THROWS_AS(vect.at(200), IllegalIndexException);
+}
+
+TEST_CASE("SegmentedVector keeps element addresses") {
+    SegmentedVector<std::string, 16> vect;
+    vect.push("first");
+    std::string* first = &vect[0];
+    for (int i = 0; i < 10000; i++) vect.push(std::to_string(i));
+    for (int i = 0; i < 10000; i++) vect.pushFront(std::to_string(i));
+    REQUIRE(first == &vect[10000]);
+    REQUIRE(*first == "first");
+
+    // Arguments referring to elements stay valid while the directory grows
+    for (int i = 0; i < 100; i++) vect.push(vect[10000]);
+    REQUIRE(vect.last() == "first");
+}
+
+TEST_CASE("SegmentedVector as a queue") {
+    SegmentedVector<int, 4> queue;
+    int next = 0;
+    for (int round = 0; round < 1000; round++) {
+        for (int i = 0; i < 3; i++) queue.push(next++);
+        for (int i = 0; i < 2; i++) queue.popFront();
+    }
+    REQUIRE(queue.size() == 1000);
+    REQUIRE(queue.first() == 2000);
+    REQUIRE(queue.last() == 2999);
+    // Emptied segments are given back
+    REQUIRE(queue.segments() <= 1000 / 4 + 2);
+
+    while (!queue.empty()) queue.pop();
+    REQUIRE(queue.segments() == 0);
+    queue.pop();
+    queue.popFront();
+    REQUIRE(queue.empty());
+    queue.pushFront(1);
+    queue.push(2);
+    REQUIRE(queue.first() == 1);
+    REQUIRE(queue.last() == 2);
+}
+
+TEST_CASE("SegmentedVector matches std::deque") {
+    SegmentedVector<long, 4> vect;
+    std::deque<long> expected;
+    unsigned state = 12345;
+    for (int step = 0; step < 20000; step++) {
+        state = state * 1103515245u + 12345u;
+        switch ((state >> 16) % 5) {
+            case 0: vect.push(step); expected.push_back(step); break;
+            case 1: vect.pushFront(step); expected.push_front(step); break;
+            case 2: vect.pop(); if (!expected.empty()) expected.pop_back(); break;
+            case 3: vect.popFront(); if (!expected.empty()) expected.pop_front(); break;
+            default: vect.emplace(-step); expected.push_back(-step); break;
+        }
+    }
+    REQUIRE(vect.size() == expected.size());
+    REQUIRE(std::equal(vect.begin(), vect.end(), expected.begin()));
+}
+
+TEST_CASE("SegmentedVector iterators") {
+    SegmentedVector<int, 4> vect = {5, 3, 9, 1, 7, 2, 8};
+    std::sort(vect.begin(), vect.end());
+    REQUIRE(vect == SegmentedVector<int, 4>({1, 2, 3, 5, 7, 8, 9}));
+
+    const SegmentedVector<int, 4>& constant = vect;
+    SegmentedVector<int, 4>::const_iterator it = vect.begin();
+    REQUIRE(it == constant.begin());
+    REQUIRE(constant.end() - constant.begin() == 7);
+    REQUIRE(*(it + 3) == 5);
+    REQUIRE(it[6] == 9);
+    int sum = 0;
+    for (int value: constant) sum += value;
+    REQUIRE(sum == 35);
+}
+
+TEST_CASE("SegmentedVector destroys its elements") {
+    SegmentedVector<std::shared_ptr<int>, 4> vect;
+    auto shared = std::make_shared<int>(1);
+    for (int i = 0; i < 50; i++) vect.push(shared);
+    for (int i = 0; i < 50; i++) vect.pushFront(shared);
+    REQUIRE(shared.use_count() == 101);
+    vect.resize(10);
+    REQUIRE(shared.use_count() == 11);
+    vect.clear();
+    REQUIRE(shared.use_count() == 1);
+    vect.resize(3, shared);
+    {
+        SegmentedVector<std::shared_ptr<int>, 4> copy(vect);
+        REQUIRE(shared.use_count() == 7);
+    }
+    REQUIRE(shared.use_count() == 4);
+}
+
+TEST_CASE("SegmentedVector gives back the segment of an element whose constructor threw") {
+    SegmentedVector<Fragile, 4> vect;
+    for (int i = 0; i < 4; i++) vect.emplace(i);
+    REQUIRE(vect.segments() == 1);
+
+    // Both need a segment of their own
+    REQUIRE_THROWS_AS(vect.emplaceFront(-1), std::runtime_error);
+    REQUIRE(vect.segments() == 1);
+    REQUIRE_THROWS_AS(vect.emplace(-1), std::runtime_error);
+    REQUIRE(vect.segments() == 1);
+    REQUIRE(vect.size() == 4);
+
+    // Growing at the back compacts the directory over the slots in front
+    for (int i = 4; i < 100; i++) {
+        vect.emplace(i);
+        vect.popFront();
+    }
+    REQUIRE(vect.size() == 4);
+    REQUIRE(vect.first().value == 96);
+    REQUIRE(vect.segments() <= 2);
+    vect.clear();
+    REQUIRE(vect.segments() == 0);
+}
@@ -0,0 +1,275 @@
+#include "catch.hpp"
+#include "types/Serialization.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace {
+    // Removes the file when going out of scope
+    struct SerializedFile {
+        std::string path;
+
+        SerializedFile(const std::string& name) : path((std::filesystem::temp_directory_path() / ("algorithmic-" + std::to_string(getpid()) + "-" + name)).string()) {}
+
+        ~SerializedFile() {
+            std::remove(path.c_str());
+        }
+    };
+
+    struct Sample {
+        int32_t id;
+        float weight;
+        bool operator!=(const Sample& other) const { return id != other.id || weight != other.weight; }
+    };
+
+    // Flips a byte of the payload
+    void corrupt(const std::string& path, size_t offset) {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(64 + offset);
+        char byte = 0;
+        file.get(byte);
+        file.seekp(64 + offset);
+        file.put((char)(byte ^ 1));
+    }
+
+    // Overwrites 8 bytes of the file, header included
+    void overwrite(const std::string& path, size_t position, uint64_t value) {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(position);
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+}
+
+TEST_CASE("Serialization of flat containers") {
+    SerializedFile file("flat.bin");
+
+    SECTION("Vector") {
+        Vector<int64_t> values;
+        for (int64_t i = 0; i < 10000; i++) values.push(i * i);
+        serialize(values, file.path);
+        REQUIRE(std::filesystem::file_size(file.path) == 64 + 10000 * sizeof(int64_t));
+
+        Vector<int64_t> read = {1, 2, 3};
+        deserialize(file.path, read);
+        REQUIRE(read == values);
+    }
+
+    SECTION("Array and structures") {
+        Array<Sample, 3> samples;
+        for (int i = 0; i < 3; i++) samples[i] = Sample{i, i * 0.5f};
+        serialize(samples, file.path);
+        Array<Sample, 3> read;
+        deserialize(file.path, read);
+        REQUIRE(read == samples);
+
+        Array<Sample, 4> larger;
+        REQUIRE_THROWS_AS(deserialize(file.path, larger), IOException);
+    }
+
+    SECTION("LinkedList") {
+        LinkedList<double> list;
+        for (int i = 0; i < 100; i++) list.push(i / 4.0);
+        serialize(list, file.path);
+        LinkedList<double> read;
+        deserialize(file.path, read);
+        REQUIRE(read == list);
+    }
+
+    SECTION("empty") {
+        serialize(Vector<int>(), file.path);
+        Vector<int> read = {1};
+        deserialize(file.path, read);
+        REQUIRE(read.empty());
+    }
+
+    SECTION("from one container to another") {
+        LinkedList<int> list;
+        list.push(4);
+        list.push(5);
+        serialize(list, file.path);
+        Vector<int> vect;
+        deserialize(file.path, vect);
+        REQUIRE(vect == Vector<int>({4, 5}));
+        Array<int, 2> array;
+        deserialize(file.path, array);
+        REQUIRE(array[1] == 5);
+    }
+}
+
+TEST_CASE("Serialization of nested containers") {
+    SerializedFile file("nested.bin");
+
+    SECTION("vectors of vectors") {
+        Vector<Vector<int>> rows;
+        for (int i = 0; i < 50; i++) {
+            Vector<int> row;
+            for (int j = 0; j < i; j++) row.push(i * 100 + j);
+            rows.push(row);
+        }
+        serialize(rows, file.path);
+        Vector<Vector<int>> read;
+        deserialize(file.path, read);
+        REQUIRE(read == rows);
+
+        // Same layout whatever the containers
+        LinkedList<Vector<int>> list;
+        deserialize(file.path, list);
+        REQUIRE(list.size() == 50);
+        REQUIRE(list[49] == rows[49]);
+    }
+
+    SECTION("three levels, more pieces than a single writev takes") {
+        Vector<LinkedList<Vector<char>>> tree;
+        for (int i = 0; i < 600; i++) {
+            LinkedList<Vector<char>> branch;
+            for (int j = 0; j < 3; j++) branch.push(Vector<char>(j, (char)('a' + i % 26)));
+            tree.push(branch);
+        }
+        serialize(tree, file.path);
+        Vector<LinkedList<Vector<char>>> read;
+        deserialize(file.path, read);
+        REQUIRE(read == tree);
+    }
+}
+
+TEST_CASE("SerializedView") {
+    SerializedFile file("view.bin");
+
+    SECTION("flat") {
+        Vector<float> values;
+        for (int i = 0; i < 1000; i++) values.push(i * 1.5f);
+        serialize(values, file.path);
+
+        SerializedView<Vector<float>> view(file.path);
+        REQUIRE(view.size() == 1000);
+        REQUIRE(view[999] == 999 * 1.5f);
+        REQUIRE(reinterpret_cast<uintptr_t>(view.begin()) % 16 == 0);
+        float sum = 0;
+        for (float value: view) sum += value;
+        REQUIRE(sum == values.sum());
+        REQUIRE_THROWS_AS(view[1000], IllegalIndexException);
+    }
+
+    SECTION("nested") {
+        Vector<Vector<double>> rows = {{1, 2}, {}, {3}};
+        serialize(rows, file.path);
+        SerializedView<Vector<Vector<double>>> view(file.path);
+        REQUIRE(view.size() == 3);
+        REQUIRE(view[0].size() == 2);
+        REQUIRE(view[0][1] == 2);
+        REQUIRE(view[1].empty());
+        REQUIRE(view[2][0] == 3);
+        REQUIRE(reinterpret_cast<uintptr_t>(view[2].begin()) % 16 == 0);
+    }
+}
+
+TEST_CASE("Serialization rejects invalid files") {
+    SerializedFile file("invalid.bin");
+    Vector<int> values = {1, 2, 3, 4};
+    serialize(values, file.path);
+
+    SECTION("other element types") {
+        Vector<unsigned> unsignedValues;
+        REQUIRE_THROWS_AS(deserialize(file.path, unsignedValues), IOException);
+        Vector<int64_t> longValues;
+        REQUIRE_THROWS_AS(deserialize(file.path, longValues), IOException);
+        Vector<Vector<int>> nested;
+        REQUIRE_THROWS_AS(deserialize(file.path, nested), IOException);
+        REQUIRE_THROWS_AS(SerializedView<Vector<float>>(file.path), IOException);
+    }
+
+    SECTION("corruption") {
+        corrupt(file.path, 5);
+        Vector<int> read = {9};
+        REQUIRE_THROWS_AS(deserialize(file.path, read), IOException);
+        // Left as it was
+        REQUIRE(read == Vector<int>({9}));
+        REQUIRE_THROWS_AS(SerializedView<Vector<int>>(file.path), IOException);
+        REQUIRE(SerializedView<Vector<int>>(file.path, false)[1] != 2);
+    }
+
+    SECTION("truncated or missing") {
+        std::filesystem::resize_file(file.path, 70);
+        Vector<int> read;
+        REQUIRE_THROWS_AS(deserialize(file.path, read), IOException);
+        std::filesystem::remove(file.path);
+        REQUIRE_THROWS_AS(deserialize(file.path, read), IOException);
+    }
+
+    SECTION("corrupted header") {
+        // Element count
+        overwrite(file.path, 24, 1000000);
+        LinkedList<int> list;
+        REQUIRE_THROWS_AS(deserialize(file.path, list), IOException);
+        Vector<int> read;
+        REQUIRE_THROWS_AS(deserialize(file.path, read), IOException);
+        REQUIRE_THROWS_AS(SerializedView<Vector<int>>(file.path), IOException);
+        REQUIRE_THROWS_AS(SerializedView<Vector<int>>(file.path, false), IOException);
+    }
+}
+
+TEST_CASE("Serialization checks offsets and counts of nested containers") {
+    SerializedFile file("nested-invalid.bin");
+    Vector<Vector<int>> rows = {{1, 2}, {3}};
+    serialize(rows, file.path);
+    // Offset table of 3 entries padded to 32 bytes, then each row: its count, padding and elements
+    const size_t payload = 64;
+
+    SECTION("offsets") {
+        overwrite(file.path, payload + 16, 1 << 20);
+        SerializedView<Vector<Vector<int>>> view(file.path, false);
+        REQUIRE(view[0].size() == 2);
+        REQUIRE_THROWS_AS(view[1], IOException);
+        Vector<Vector<int>> read;
+        REQUIRE_THROWS_AS(deserialize(file.path, read), IOException);
+    }
+
+    SECTION("counts of the nested containers") {
+        overwrite(file.path, payload + 32, 1 << 20);
+        SerializedView<Vector<Vector<int>>> view(file.path, false);
+        REQUIRE_THROWS_AS(view[0], IOException);
+        REQUIRE(view[1][0] == 3);
+        LinkedList<LinkedList<int>> read;
+        REQUIRE_THROWS_AS(deserialize(file.path, read), IOException);
+    }
+
+    SECTION("count of the outer container") {
+        overwrite(file.path, 24, 1 << 20);
+        REQUIRE_THROWS_AS(SerializedView<Vector<Vector<int>>>(file.path, false), IOException);
+    }
+}
+
+TEST_CASE("Serialization replaces files as a whole") {
+    SerializedFile file("replaced.bin");
+    Vector<int> first(1000, 1);
+    Vector<int> second(2000, 2);
+
+    SECTION("concurrent writers to a same path") {
+        std::thread writer([&]() {
+            for (int i = 0; i < 50; i++) serialize(first, file.path);
+        });
+        for (int i = 0; i < 50; i++) serialize(second, file.path);
+        writer.join();
+
+        Vector<int> read;
+        deserialize(file.path, read);
+        REQUIRE((read == first || read == second));
+    }
+
+    SECTION("no temporary file is left behind") {
+        serialize(first, file.path);
+        serialize(second, file.path);
+        std::filesystem::path written(file.path);
+        size_t siblings = 0;
+        for (auto& entry: std::filesystem::directory_iterator(written.parent_path())) {
+            siblings += entry.path().filename().string().rfind(written.filename().string(), 0) == 0;
+        }
+        REQUIRE(siblings == 1);
+        auto permissions = std::filesystem::status(file.path).permissions();
+        REQUIRE((permissions & std::filesystem::perms::others_read) != std::filesystem::perms::none);
+    }
+}
@@ -0,0 +1,81 @@
+#include "catch.hpp"
+#include "types/SimdKernels.hpp"
+#include "types/Vector.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+
+namespace {
+    const SimdWidth widths[] = {SimdWidth::Scalar, SimdWidth::Bits128, SimdWidth::Bits256, SimdWidth::Bits512};
+
+    // Every kernel, at every width, must give the scalar results. Sizes around the vector widths exercise the tails.
+    template <typename T>
+    void checkKernels(T low, T high) {
+        std::srand(3);
+        for (size_t size: {1, 2, 3, 7, 8, 15, 16, 17, 31, 33, 63, 64, 65, 100, 129, 1000, 4099}) {
+            Vector<T> values;
+            Vector<T> others;
+            for (size_t i = 0; i < size; i++) {
+                values.push(static_cast<T>(low + std::rand() % (int)(high - low)));
+                others.push(static_cast<T>(low + std::rand() % (int)(high - low)));
+            }
+            const T* data = values.begin();
+            T needle = values[size * 3 / 4];
+
+            T sum = 0, dot = 0, min = values[0], max = values[0];
+            size_t found = size, count = 0;
+            for (size_t i = 0; i < size; i++) {
+                sum += values[i];
+                dot += values[i] * others[i];
+                if (values[i] < min) min = values[i];
+                if (values[i] > max) max = values[i];
+                if (values[i] == needle) {
+                    if (found == size) found = i;
+                    count++;
+                }
+            }
+
+            for (SimdWidth width: widths) {
+                REQUIRE(SimdKernels<T>::sum(data, size, width) == sum);
+                REQUIRE(SimdKernels<T>::dot(data, others.begin(), size, width) == dot);
+                REQUIRE(SimdKernels<T>::min(data, size, width) == min);
+                REQUIRE(SimdKernels<T>::max(data, size, width) == max);
+                REQUIRE(SimdKernels<T>::find(data, size, needle, width) == found);
+                REQUIRE(SimdKernels<T>::find(data, size, static_cast<T>(high + 1), width) == size);
+                REQUIRE(SimdKernels<T>::count(data, size, needle, width) == count);
+
+                Vector<T> y(others);
+                SimdKernels<T>::axpy(2, data, y.begin(), size, width);
+                bool same = true;
+                for (size_t i = 0; i < size; i++) same = same && y[i] == static_cast<T>(others[i] + 2 * values[i]);
+                REQUIRE(same);
+            }
+        }
+    }
+}
+
+TEST_CASE("SimdKernels match scalar results") {
+    // Small integer values keep floating point results exact whatever the order of the additions
+    SECTION("int8_t") { checkKernels<int8_t>(-3, 4); }
+    SECTION("uint16_t") { checkKernels<uint16_t>(0, 50); }
+    SECTION("int32_t") { checkKernels<int32_t>(-1000, 1000); }
+    SECTION("int64_t") { checkKernels<int64_t>(-100000, 100000); }
+    SECTION("float") { checkKernels<float>(-100, 100); }
+    SECTION("double") { checkKernels<double>(-1000, 1000); }
+}
+
+TEST_CASE("SimdKernels counts beyond the capacity of narrow lanes") {
+    Vector<int8_t> values(100000, 1);
+    values[500] = 2;
+    for (SimdWidth width: widths) {
+        REQUIRE(SimdKernels<int8_t>::count(values.begin(), values.size(), 1, width) == 99999);
+        REQUIRE(SimdKernels<int8_t>::sum(values.begin(), values.size(), width) == (int8_t)(99999 + 2));
+    }
+}
+
+TEST_CASE("SimdKernels of non vectorizable arithmetic types") {
+    Vector<long double> values = {1.5L, -2.0L, 4.0L};
+    REQUIRE(SimdKernels<long double>::sum(values.begin(), 3) == 3.5L);
+    REQUIRE(SimdKernels<long double>::min(values.begin(), 3) == -2.0L);
+    REQUIRE(SimdKernels<long double>::find(values.begin(), 3, 4.0L) == 2);
+}
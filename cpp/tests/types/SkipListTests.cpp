@@ -0,0 +1,329 @@
+#include "catch.hpp"
+#include "types/ConcurrentSkipList.hpp"
+#include "types/SkipList.hpp"
+#include "types/Vector.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <thread>
+
+namespace {
+    // Counts the values alive, entries included
+    struct Counted {
+        static inline std::atomic<long> alive{0};
+        int value;
+
+        Counted(int value = 0) : value(value) { alive++; }
+        Counted(const Counted& other) : value(other.value) { alive++; }
+        Counted& operator=(const Counted& other) = default;
+        ~Counted() { alive--; }
+    };
+}
+
+TEST_CASE("SkipList insertion, lookup and removal") {
+    SkipList<int, std::string> list;
+    REQUIRE(list.empty());
+    REQUIRE(list.begin() == list.end());
+    REQUIRE(!list.erase(1));
+
+    REQUIRE(list.insert(5, "five"));
+    REQUIRE(list.insert(1, "one"));
+    REQUIRE(list.insert(3, "three"));
+    REQUIRE(!list.insert(3, "other"));
+    REQUIRE(list.size() == 3);
+
+    REQUIRE(list.contains(1));
+    REQUIRE(!list.contains(2));
+    REQUIRE(list.get(3) == "three");
+    REQUIRE_THROWS_AS(list.get(4), IllegalAccessException);
+    list.get(5) = "FIVE";
+    REQUIRE(list.find(5)->value == "FIVE");
+    REQUIRE(list.find(4) == list.end());
+
+    Vector<int> keys;
+    for (auto& entry: list) keys.push(entry.key);
+    REQUIRE(keys == Vector<int>({1, 3, 5}));
+
+    REQUIRE(list.erase(3));
+    REQUIRE(!list.erase(3));
+    REQUIRE(!list.contains(3));
+    REQUIRE(list.size() == 2);
+
+    list.clear();
+    REQUIRE(list.empty());
+    REQUIRE(list.insert(2, "two"));
+    REQUIRE(list.get(2) == "two");
+}
+
+TEST_CASE("SkipList ordered ranges") {
+    SkipList<int, int> list;
+    for (int i = 0; i < 100; i += 2) list.insert(i, i * i);
+
+    REQUIRE(list.lowerBound(31)->key == 32);
+    REQUIRE(list.lowerBound(32)->key == 32);
+    REQUIRE(list.lowerBound(99) == list.end());
+
+    Vector<int> keys;
+    for (auto& entry: list.range(11, 20)) {
+        REQUIRE(entry.value == entry.key * entry.key);
+        keys.push(entry.key);
+    }
+    REQUIRE(keys == Vector<int>({12, 14, 16, 18}));
+
+    int count = 0;
+    for (auto& entry: list.range(90, 1000)) count += entry.key >= 90;
+    REQUIRE(count == 5);
+    for (auto& entry: list.range(20, 20)) count += entry.key;
+    for (auto& entry: list.range(20, 10)) count += entry.key;
+    REQUIRE(count == 5);
+}
+
+TEST_CASE("SkipList copy and move") {
+    SkipList<int, std::string> list;
+    for (int i = 0; i < 50; i++) list.insert(i, std::to_string(i));
+
+    SkipList<int, std::string> copy(list);
+    REQUIRE(copy == list);
+    copy.erase(10);
+    REQUIRE(copy != list);
+    REQUIRE(list.contains(10));
+    // The copy keeps a working structure
+    for (int i = 50; i < 100; i++) copy.insert(i, std::to_string(i));
+    REQUIRE(copy.get(75) == "75");
+
+    SkipList<int, std::string> assigned;
+    assigned.insert(-1, "-1");
+    assigned = list;
+    REQUIRE(assigned == list);
+
+    SkipList<int, std::string> moved(std::move(assigned));
+    REQUIRE(moved == list);
+    REQUIRE(assigned.empty());
+
+    assigned = std::move(moved);
+    REQUIRE(assigned == list);
+    REQUIRE(moved.empty());
+}
+
+TEST_CASE("SkipList random operations") {
+    SkipList<int, int> list;
+    std::map<int, int> expected;
+    srand(7);
+
+    for (int i = 0; i < 20000; i++) {
+        int key = rand() % 2000;
+        if (rand() % 3 == 0) {
+            REQUIRE(list.erase(key) == (expected.erase(key) == 1));
+        } else {
+            REQUIRE(list.insert(key, i) == expected.insert({key, i}).second);
+        }
+    }
+
+    REQUIRE(list.size() == expected.size());
+    auto it = expected.begin();
+    bool same = true;
+    for (auto& entry: list) {
+        same = same && entry.key == it->first && entry.value == it->second;
+        ++it;
+    }
+    REQUIRE(same);
+}
+
+TEST_CASE("ConcurrentSkipList single threaded") {
+    ConcurrentSkipList<int, std::string> list;
+    std::string value;
+    REQUIRE(list.empty());
+    REQUIRE(!list.find(1, value));
+
+    REQUIRE(list.insert(2, "two"));
+    REQUIRE(list.insert(1, "one"));
+    REQUIRE(list.insert(3, "three"));
+    REQUIRE(!list.insert(2, "other"));
+    REQUIRE(list.size() == 3);
+
+    REQUIRE(list.find(2, value));
+    REQUIRE(value == "two");
+    REQUIRE(list.contains(3));
+
+    REQUIRE(list.erase(2));
+    REQUIRE(!list.erase(2));
+    REQUIRE(!list.contains(2));
+
+    Vector<int> keys;
+    for (auto& entry: list.range(0, 10)) keys.push(entry.key);
+    REQUIRE(keys == Vector<int>({1, 3}));
+}
+
+TEST_CASE("ConcurrentSkipList concurrent updates") {
+    const int threadCount = 4;
+    const int perThread = 5000;
+    ConcurrentSkipList<int, int> list;
+
+    SECTION("disjoint insertions") {
+        Vector<std::thread> threads;
+        for (int t = 0; t < threadCount; t++) {
+            threads.push(std::thread([&list, t]() {
+                for (int i = 0; i < perThread; i++) list.insert(i * threadCount + t, t);
+            }));
+        }
+        for (auto& thread: threads) thread.join();
+
+        REQUIRE(list.size() == threadCount * perThread);
+        int expected = 0;
+        bool ordered = true;
+        for (auto& entry: list.range(0, threadCount * perThread)) {
+            ordered = ordered && entry.key == expected && entry.value == expected % threadCount;
+            expected++;
+        }
+        REQUIRE(ordered);
+        REQUIRE(expected == threadCount * perThread);
+    }
+
+    SECTION("contended insertions and removals") {
+        // Every thread inserts and erases the same keys, each key must end up inserted and erased exactly as many
+        // times in total
+        const int keys = 256;
+        std::atomic<int> insertions[keys];
+        std::atomic<int> removals[keys];
+        for (int k = 0; k < keys; k++) {
+            insertions[k] = 0;
+            removals[k] = 0;
+        }
+
+        Vector<std::thread> threads;
+        for (int t = 0; t < threadCount; t++) {
+            threads.push(std::thread([&, t]() {
+                unsigned seed = t + 1;
+                for (int i = 0; i < perThread; i++) {
+                    seed = seed * 1103515245 + 12345;
+                    int key = (seed >> 8) % keys;
+                    if ((seed >> 4) & 1) {
+                        if (list.insert(key, key)) insertions[key]++;
+                    } else {
+                        if (list.erase(key)) removals[key]++;
+                    }
+                    int value;
+                    if (list.find(key, value) && value != key) removals[key] += 1000;
+                }
+            }));
+        }
+        for (auto& thread: threads) thread.join();
+
+        bool consistent = true;
+        size_t present = 0;
+        for (int k = 0; k < keys; k++) {
+            int difference = insertions[k] - removals[k];
+            consistent = consistent && difference == (list.contains(k) ? 1 : 0);
+            present += list.contains(k);
+        }
+        REQUIRE(consistent);
+        REQUIRE(list.size() == present);
+
+        int previous = -1;
+        bool ordered = true;
+        for (auto& entry: list.range(0, keys)) {
+            ordered = ordered && entry.key > previous;
+            previous = entry.key;
+        }
+        REQUIRE(ordered);
+    }
+}
+
+TEST_CASE("ConcurrentSkipList reclaims removed entries while updates go on") {
+    const int threadCount = 4;
+    const int perThread = 50000;
+    const int keys = 64;
+    long before = Counted::alive;
+    long peak = 0;
+    {
+        ConcurrentSkipList<int, Counted> list;
+        std::atomic<int> running(threadCount);
+
+        Vector<std::thread> threads;
+        for (int t = 0; t < threadCount; t++) {
+            threads.push(std::thread([&, t]() {
+                unsigned seed = t + 1;
+                for (int i = 0; i < perThread; i++) {
+                    seed = seed * 1103515245 + 12345;
+                    int key = (seed >> 8) % keys;
+                    if (!list.insert(key, Counted(key))) list.erase(key);
+                }
+                running--;
+            }));
+        }
+        // Sampled only while every thread is still updating, no pause ever lets them all finish their operations
+        while (running == threadCount) {
+            long alive = Counted::alive - before;
+            if (alive > peak) peak = alive;
+            std::this_thread::yield();
+        }
+        for (auto& thread: threads) thread.join();
+
+        // A range alive delays reclamation but does not prevent it once gone
+        {
+            auto range = list.range(0, keys);
+            for (int key = 0; key < keys; key++) list.erase(key);
+        }
+        for (int i = 0; i < 4 * (int)EpochReclamation::RetiredThreshold; i++) {
+            list.insert(keys, Counted(keys));
+            list.erase(keys);
+        }
+        REQUIRE(Counted::alive - before <= 3 * (long)EpochReclamation::RetiredThreshold);
+    }
+    // About a hundred thousand entries got removed, only a few batches per thread may have been waiting at any time
+    REQUIRE(peak > 0);
+    REQUIRE(peak <= keys + threadCount * 16 * (long)EpochReclamation::RetiredThreshold);
+}
+
+TEST_CASE("ConcurrentSkipList erases entries whose upper levels are still being linked") {
+    // Few keys, so that removals often catch entries with several levels while their inserter is still linking them,
+    // while a reader walks the list
+    const int keys = 4;
+    const int perThread = 40000;
+    long before = Counted::alive;
+    {
+        ConcurrentSkipList<int, Counted> list;
+        std::atomic<bool> done(false);
+        bool valid = true;
+
+        Vector<std::thread> threads;
+        for (int t = 0; t < 2; t++) {
+            threads.push(std::thread([&list, t]() {
+                for (int i = 0; i < perThread; i++) list.insert((i + t) % keys, Counted(i));
+            }));
+            threads.push(std::thread([&list, t]() {
+                for (int i = 0; i < perThread; i++) list.erase((i + t) % keys);
+            }));
+        }
+        std::thread reader([&]() {
+            while (!done) {
+                for (auto& entry: list.range(0, keys)) valid = valid && entry.key < keys && entry.value.value < perThread;
+            }
+        });
+        for (auto& thread: threads) thread.join();
+        done = true;
+        reader.join();
+        REQUIRE(valid);
+
+        int previous = -1;
+        size_t present = 0;
+        bool ordered = true;
+        for (auto& entry: list.range(0, keys)) {
+            ordered = ordered && entry.key > previous;
+            previous = entry.key;
+            present++;
+        }
+        REQUIRE(ordered);
+        REQUIRE(present == list.size());
+    }
+    // Retired entries may still wait for a few epochs, but none got freed twice or lost
+    for (int i = 0; i < 4 * (int)EpochReclamation::RetiredThreshold; i++) {
+        ConcurrentSkipList<int, Counted> list;
+        list.insert(0, Counted(0));
+        list.erase(0);
+    }
+    REQUIRE(Counted::alive - before <= 3 * (long)EpochReclamation::RetiredThreshold);
+    REQUIRE(Counted::alive - before >= 0);
+}
@@ -0,0 +1,258 @@
+#include "catch.hpp"
+#include "types/SmallVector.hpp"
+#include "types/Vector.hpp"
+
+#include <list>
+#include <string>
+
+TEST_CASE("SmallVector constructors and copy/move semantics") {
+    SECTION("SmallVector::SmallVector()") {
+        SmallVector<int, 4> vect;
+        REQUIRE(vect.size() == 0);
+        REQUIRE(vect.empty());
+        REQUIRE(vect.capacity() == 4);
+        REQUIRE(vect.isInline());
+    }
+
+    SECTION("SmallVector::SmallVector(size_t, const T&)") {
+        SmallVector<int, 4> vect(3, 1);
+        REQUIRE(vect.size() == 3);
+        REQUIRE(vect[0] == 1);
+        REQUIRE(vect[2] == 1);
+        REQUIRE(vect.isInline());
+
+        SmallVector<int, 4> spilled(5, 1);
+        REQUIRE(spilled.size() == 5);
+        REQUIRE(spilled[4] == 1);
+        REQUIRE(!spilled.isInline());
+    }
+
+    SECTION("SmallVector::SmallVector(const SmallVector&)") {
+        const SmallVector<int, 2> vect = {0, 1, 2};
+        const SmallVector<int, 2> copy(vect);
+
+        REQUIRE(copy == vect);
+        REQUIRE(copy.begin() != vect.begin());
+    }
+
+    SECTION("SmallVector::SmallVector(SmallVector&&) with inline elements") {
+        SmallVector<std::string, 4> vect = {"a", "b"};
+        SmallVector<std::string, 4> moved(std::move(vect));
+
+        REQUIRE(moved == SmallVector<std::string, 4>({"a", "b"}));
+        REQUIRE(moved.isInline());
+        REQUIRE(vect.empty());
+    }
+
+    SECTION("SmallVector::SmallVector(SmallVector&&) with heap elements") {
+        SmallVector<std::string, 2> vect = {"a", "b", "c"};
+        const std::string* buffer = vect.begin();
+        SmallVector<std::string, 2> moved(std::move(vect));
+
+        REQUIRE(moved.begin() == buffer);
+        REQUIRE(moved == SmallVector<std::string, 2>({"a", "b", "c"}));
+        REQUIRE(vect.empty());
+        REQUIRE(vect.isInline());
+    }
+
+    SECTION("operator=(SmallVector&&)") {
+        SmallVector<int, 2> vect = {0, 1, 2};
+        SmallVector<int, 2> moved = {3};
+        moved = std::move(vect);
+        REQUIRE(moved == SmallVector<int, 2>({0, 1, 2}));
+        REQUIRE(vect.empty());
+
+        SmallVector<int, 2> small = {4};
+        moved = std::move(small);
+        REQUIRE(moved == SmallVector<int, 2>({4}));
+        REQUIRE(small.empty());
+    }
+
+    SECTION("SmallVector::swap(SmallVector&)") {
+        SmallVector<int, 2> inlined = {0};
+        SmallVector<int, 2> spilled = {1, 2, 3};
+        inlined.swap(spilled);
+
+        REQUIRE(inlined == SmallVector<int, 2>({1, 2, 3}));
+        REQUIRE(spilled == SmallVector<int, 2>({0}));
+        REQUIRE(spilled.isInline());
+    }
+}
+
+TEST_CASE("SmallVector elements getter and setters") {
+    SmallVector<int, 4> vect(3, 0);
+
+    for (int i = 0; i < 3; i++) {
+        vect[i] = i;
+    }
+
+    const SmallVector<int, 4> cvect(vect);
+
+    REQUIRE(vect[2] == 2);
+    REQUIRE(vect.at(1) == 1);
+    REQUIRE_THROWS_AS(vect[3], IllegalIndexException);
+    REQUIRE_THROWS_AS(vect.at(3), IllegalIndexException);
+
+    REQUIRE(cvect[2] == 2);
+    REQUIRE_THROWS_AS(cvect[3], IllegalIndexException);
+}
+
+TEST_CASE("SmallVector size-modifying functions") {
+    SECTION("push stays inline up to N elements") {
+        SmallVector<int, 4> vect;
+        for (int i = 0; i < 4; i++) vect.push(i);
+        REQUIRE(vect.isInline());
+        REQUIRE(vect.capacity() == 4);
+
+        vect.push(4);
+        REQUIRE(!vect.isInline());
+        REQUIRE(vect.capacity() == 8);
+        REQUIRE(vect == SmallVector<int, 4>({0, 1, 2, 3, 4}));
+    }
+
+    SECTION("push of an element of the vector itself while spilling") {
+        SmallVector<std::string, 2> vect = {"a", "b"};
+        vect.push(vect.first());
+        REQUIRE(vect == SmallVector<std::string, 2>({"a", "b", "a"}));
+    }
+
+    SECTION("pop/erase/insert") {
+        SmallVector<int, 2> vect = {0, 1, 2, 3};
+        vect.erase(1);
+        REQUIRE(vect == SmallVector<int, 2>({0, 2, 3}));
+        vect.insert(0, 5);
+        REQUIRE(vect == SmallVector<int, 2>({5, 0, 2, 3}));
+        vect.pop();
+        REQUIRE(vect == SmallVector<int, 2>({5, 0, 2}));
+        REQUIRE_THROWS_AS(vect.erase(3), IllegalIndexException);
+        REQUIRE_THROWS_AS(vect.insert(3, 0), IllegalIndexException);
+    }
+
+    SECTION("resize") {
+        SmallVector<std::string, 2> vect = {"a"};
+        vect.resize(3, "z");
+        REQUIRE(vect == SmallVector<std::string, 2>({"a", "z", "z"}));
+        vect.resize(1);
+        REQUIRE(vect == SmallVector<std::string, 2>({"a"}));
+    }
+
+    SECTION("range insert, append and erase") {
+        SmallVector<std::string, 2> vect = {"a", "d"};
+        vect.insert(1, {"b", "c"});
+        REQUIRE(vect == SmallVector<std::string, 2>({"a", "b", "c", "d"}));
+        std::list<std::string> tail = {"e", "f"};
+        vect.append(tail.begin(), tail.end());
+        vect.append({"g"});
+        REQUIRE(vect.size() == 7);
+        vect.erase(1, 6);
+        REQUIRE(vect == SmallVector<std::string, 2>({"a", "g"}));
+        vect.emplace(1, 3, 'x');
+        REQUIRE(vect == SmallVector<std::string, 2>({"a", "xxx", "g"}));
+        REQUIRE_THROWS_AS(vect.erase(2, 4), IllegalIndexException);
+    }
+
+    SECTION("range insert of elements of the vector itself") {
+        SmallVector<int, 2> vect = {0, 1, 2};
+        vect.insert(0, vect.begin(), vect.end());
+        REQUIRE(vect == SmallVector<int, 2>({0, 1, 2, 0, 1, 2}));
+        vect.append(vect.begin(), vect.begin() + 2);
+        REQUIRE(vect == SmallVector<int, 2>({0, 1, 2, 0, 1, 2, 0, 1}));
+    }
+
+    SECTION("reserveExact and shrinkToFit") {
+        SmallVector<std::string, 2> vect = {"a"};
+        vect.reserveExact(10);
+        REQUIRE(vect.capacity() == 10);
+        vect.push("b");
+        vect.push("c");
+        vect.shrinkToFit();
+        REQUIRE(vect.capacity() == 3);
+        vect.pop();
+        vect.shrinkToFit();
+        REQUIRE(vect.isInline());
+        REQUIRE(vect == SmallVector<std::string, 2>({"a", "b"}));
+    }
+
+    SECTION("deallocate goes back to the inline buffer") {
+        SmallVector<int, 2> vect = {0, 1, 2};
+        vect.deallocate();
+        REQUIRE(vect.empty());
+        REQUIRE(vect.isInline());
+        REQUIRE(vect.capacity() == 2);
+    }
+}
+
+TEST_CASE("SmallVector Helper functions") {
+    SmallVector<int, 2> vect = {0, 1};
+
+    SECTION("fill") {
+        vect.fill(2);
+        REQUIRE(vect == SmallVector<int, 2>({2, 2}));
+    }
+
+    SECTION("swap") {
+        vect.swap(0, 1);
+        REQUIRE(vect == SmallVector<int, 2>({1, 0}));
+    }
+
+    SECTION("first/last") {
+        REQUIRE(vect.first() == 0);
+        REQUIRE(vect.last() == 1);
+    }
+}
+
+TEST_CASE("SmallVector Iterators") {
+    SmallVector<int, 2> vect = {1, 2, 3};
+
+    int result = 0;
+    for(const int& value: vect) {
+        result += value;
+    }
+
+    REQUIRE(result == 6);
+}
+
+TEST_CASE("SmallVector kernels") {
+    SmallVector<int, 4> vect = {1, 2, 3, 2, 5};
+    REQUIRE(vect.sum() == 13);
+    REQUIRE(vect.min() == 1);
+    REQUIRE(vect.max() == 5);
+    REQUIRE(vect.dot(vect) == 43);
+    REQUIRE(*vect.find(3) == 3);
+    REQUIRE(vect.occurrences(2) == 2);
+    vect.axpy(2, SmallVector<int, 4>(5, 1));
+    REQUIRE(vect == SmallVector<int, 4>({3, 4, 5, 4, 7}));
+    SmallVector<int, 4> empty;
+    REQUIRE_THROWS_AS(empty.min(), IllegalAccessException);
+}
+
+namespace {
+    // Uses the operations shared by Vector and SmallVector
+    template <typename V>
+    V exercise() {
+        V vect;
+        for (int i = 0; i < 10; i++) vect.push(i);
+        vect.insert(2, {20, 21});
+        vect.emplace(0, -1);
+        vect.append({30, 31});
+        vect.erase(4, 7);
+        vect.reserveExact(64);
+        vect.shrinkToFit();
+        vect.resize(14, 7);
+        vect.insert(vect.size(), vect.begin(), vect.begin() + 3);
+        // Element-wise expressions, evaluated in place then into a vector of another size
+        V tripled = vect + vect * 2;
+        vect = tripled - vect;
+        V squared = {1, 2};
+        squared = vect * vect + 1;
+        return squared;
+    }
+}
+
+TEST_CASE("SmallVector replaces Vector") {
+    Vector<int> expected = exercise<Vector<int>>();
+    SmallVector<int, 4> small = exercise<SmallVector<int, 4>>();
+    REQUIRE(small.size() == expected.size());
+    REQUIRE(std::equal(small.begin(), small.end(), expected.begin()));
+    REQUIRE(small.sum() == expected.sum());
+}
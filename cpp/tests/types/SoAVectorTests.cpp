@@ -0,0 +1,200 @@
+#include "catch.hpp"
+#include "types/SoAVector.hpp"
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+namespace {
+    // Throws when copied while armed
+    struct Fragile {
+        static bool armed;
+        int value = 0;
+
+        Fragile(int value = 0) : value(value) {}
+
+        Fragile(const Fragile& other) : value(other.value) {
+            if (armed) throw IllegalAccessException();
+        }
+
+        Fragile& operator=(const Fragile&) = default;
+
+        bool operator==(const Fragile& other) const {
+            return value == other.value;
+        }
+
+        bool operator!=(const Fragile& other) const {
+            return value != other.value;
+        }
+    };
+
+    bool Fragile::armed = false;
+}
+
+TEST_CASE("SoAVector constructors and copy/move semantics") {
+    SECTION("default") {
+        SoAVector<int, double> vect;
+        REQUIRE(vect.empty());
+        REQUIRE(vect.begin() == vect.end());
+    }
+
+    SECTION("copies") {
+        SoAVector<int, std::string> vect = {{1, "a"}, {2, "b"}};
+        SoAVector<int, std::string> copy(vect);
+        REQUIRE(copy == vect);
+        std::get<1>(copy[0]) = "c";
+        REQUIRE(copy != vect);
+        copy = vect;
+        REQUIRE(copy == vect);
+    }
+
+    SECTION("moves") {
+        SoAVector<int, std::string> vect = {{1, "a"}, {2, "b"}};
+        const int* keys = vect.data<0>();
+        SoAVector<int, std::string> moved(std::move(vect));
+        REQUIRE(moved.size() == 2);
+        REQUIRE(moved.data<0>() == keys);
+        vect = std::move(moved);
+        REQUIRE(vect.size() == 2);
+        REQUIRE(std::get<1>(vect[1]) == "b");
+    }
+}
+
+TEST_CASE("SoAVector rows and columns") {
+    SoAVector<int, double, std::string> vect;
+    for (int i = 0; i < 100; i++) vect.push(i, i * 0.5, std::to_string(i));
+
+    SECTION("rows") {
+        REQUIRE(vect.size() == 100);
+        auto [key, half, name] = vect[42];
+        REQUIRE(key == 42);
+        REQUIRE(half == 21.0);
+        REQUIRE(name == "42");
+        half = -1;
+        REQUIRE(std::get<1>(vect[42]) == -1);
+        vect[43] = std::make_tuple(0, 0.0, std::string("zero"));
+        REQUIRE(vect.at(43) == std::make_tuple(0, 0.0, std::string("zero")));
+        REQUIRE_THROWS_AS(vect.at(100), IllegalIndexException);
+    }
+
+    SECTION("columns are contiguous and aligned") {
+        auto keys = vect.column<0>();
+        REQUIRE(keys.size() == 100);
+        REQUIRE(keys.data() == vect.data<0>());
+        REQUIRE((uintptr_t)vect.data<0>() % 64 == 0);
+        REQUIRE((uintptr_t)vect.data<1>() % 64 == 0);
+        REQUIRE((uintptr_t)vect.data<2>() % 64 == 0);
+        long sum = 0;
+        for (int key: keys) sum += key;
+        REQUIRE(sum == 4950);
+        for (double& half: vect.column<1>()) half *= 2;
+        REQUIRE(std::get<1>(vect[99]) == 99.0);
+        REQUIRE_THROWS_AS(keys.at(100), IllegalIndexException);
+    }
+
+    SECTION("pop, resize and clear") {
+        vect.pop();
+        REQUIRE(vect.size() == 99);
+        vect.resize(120);
+        REQUIRE(vect.size() == 120);
+        REQUIRE(vect[119] == std::make_tuple(0, 0.0, std::string()));
+        vect.resize(10);
+        REQUIRE(vect.column<2>().size() == 10);
+        vect.clear();
+        REQUIRE(vect.empty());
+        REQUIRE_THROWS_AS(vect.pop(), IllegalIndexException);
+    }
+
+    SECTION("pushing a field of the vector itself") {
+        SoAVector<std::string, int> strings;
+        strings.push("a", 1);
+        for (int i = 0; i < 20; i++) strings.push(std::get<0>(strings[0]), i);
+        REQUIRE(strings.size() == 21);
+        REQUIRE(std::get<0>(strings[20]) == "a");
+    }
+}
+
+TEST_CASE("SoAVector iterators") {
+    SoAVector<int, char> vect = {{1, 'a'}, {2, 'b'}, {3, 'c'}};
+
+    int sum = 0;
+    std::string letters;
+    for (auto [key, letter]: vect) {
+        sum += key;
+        letters += letter;
+        key *= 10;
+    }
+    REQUIRE(sum == 6);
+    REQUIRE(letters == "abc");
+    REQUIRE(std::get<0>(vect[2]) == 30);
+
+    const SoAVector<int, char>& constant = vect;
+    SoAVector<int, char>::const_iterator it = vect.begin();
+    REQUIRE(it == constant.begin());
+    REQUIRE(constant.end() - it == 3);
+    REQUIRE(std::get<1>(it[1]) == 'b');
+    REQUIRE(std::get<1>(*(it + 2)) == 'c');
+}
+
+TEST_CASE("SoAVector reordering") {
+    SoAVector<int, std::string> vect = {{3, "c"}, {1, "a"}, {4, "d"}, {2, "b"}};
+
+    SECTION("sort by a field") {
+        vect.sortBy<0>();
+        REQUIRE(vect == SoAVector<int, std::string>({{1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}}));
+        vect.sortBy<1>(std::greater<>());
+        REQUIRE(vect == SoAVector<int, std::string>({{4, "d"}, {3, "c"}, {2, "b"}, {1, "a"}}));
+    }
+
+    SECTION("sort by whole rows") {
+        vect.push(1, "0");
+        vect.sort([](const auto& a, const auto& b) { return a < b; });
+        REQUIRE(vect == SoAVector<int, std::string>({{1, "0"}, {1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}}));
+    }
+
+    SECTION("permute") {
+        vect.permute({1, 3, 0, 2});
+        REQUIRE(vect == SoAVector<int, std::string>({{1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}}));
+        REQUIRE((uintptr_t)vect.data<1>() % 64 == 0);
+    }
+
+    SECTION("invalid permutations change nothing") {
+        SoAVector<int, std::string> copy(vect);
+        REQUIRE_THROWS_AS(vect.permute({0, 1, 2}), IllegalIndexException);
+        REQUIRE_THROWS_AS(vect.permute({0, 1, 2, 4}), IllegalIndexException);
+        REQUIRE_THROWS_AS(vect.permute({0, 1, 1, 2}), IllegalIndexException);
+        REQUIRE(vect == copy);
+    }
+}
+
+TEST_CASE("SoAVector keeps its columns the same size when a field throws") {
+    SoAVector<int, Fragile, std::string> vect;
+    vect.push(1, Fragile(1), "a");
+    vect.push(2, Fragile(2), "b");
+
+    Fragile::armed = true;
+    REQUIRE_THROWS_AS(vect.push(3, Fragile(3), "c"), IllegalAccessException);
+    Fragile fragile(4);
+    REQUIRE_THROWS_AS(vect.push(4, fragile, "d"), IllegalAccessException);
+    Fragile::armed = false;
+
+    REQUIRE(vect.size() == 2);
+    REQUIRE(vect.column<0>().size() == 2);
+    REQUIRE(vect.column<2>().size() == 2);
+    vect.push(5, Fragile(5), "e");
+    REQUIRE(vect[2] == std::make_tuple(5, Fragile(5), std::string("e")));
+}
+
+TEST_CASE("SoAVector permute leaves every column as it was when a field throws") {
+    SoAVector<int, Fragile, std::string> vect;
+    for (int i = 0; i < 4; i++) vect.push(i, Fragile(i), std::to_string(i));
+    SoAVector<int, Fragile, std::string> copy(vect);
+
+    Fragile::armed = true;
+    REQUIRE_THROWS_AS(vect.permute({3, 2, 1, 0}), IllegalAccessException);
+    Fragile::armed = false;
+
+    REQUIRE(vect == copy);
+    vect.permute({3, 2, 1, 0});
+    REQUIRE(vect[0] == std::make_tuple(3, Fragile(3), std::string("3")));
+}
@@ -0,0 +1,174 @@
+#include "catch.hpp"
+#include "types/UnrolledLinkedList.hpp"
+#include "types/Vector.hpp"
+
+#include <cstdlib>
+#include <string>
+
+TEST_CASE("UnrolledLinkedList elements getter and setters") {
+    UnrolledLinkedList<int, 4> list;
+    for (int i = 0; i < 10; i++) list.push(0);
+
+    REQUIRE(list.size() == 10);
+    for (int i = 0; i < 10; i++) list[i] = i;
+    for (int i = 0; i < 10; i++) REQUIRE(list[i] == i);
+    REQUIRE_THROWS_AS(list[10], IllegalIndexException);
+}
+
+TEST_CASE("UnrolledLinkedList instantiation") {
+    UnrolledLinkedList<std::string, 4> list;
+    for (int i = 0; i < 6; i++) list.push(std::to_string(i));
+
+    SECTION("UnrolledLinkedList::UnrolledLinkedList()") {
+        UnrolledLinkedList<int> empty;
+        REQUIRE(empty.size() == 0);
+        REQUIRE(empty.empty());
+        REQUIRE(empty.begin() == empty.end());
+    }
+
+    SECTION("copy constructors and assignment") {
+        UnrolledLinkedList<std::string, 4> copy(list);
+        REQUIRE(copy == list);
+
+        UnrolledLinkedList<std::string, 4> assigned;
+        assigned.push("a");
+        assigned = (const UnrolledLinkedList<std::string, 4>&)list;
+        REQUIRE(assigned == list);
+    }
+
+    SECTION("move constructor and assignment") {
+        UnrolledLinkedList<std::string, 4> copy(list);
+        UnrolledLinkedList<std::string, 4> moved(std::move(copy));
+        REQUIRE(moved == list);
+        REQUIRE(copy.empty());
+
+        UnrolledLinkedList<std::string, 4> assigned;
+        assigned.push("a");
+        assigned = std::move(moved);
+        REQUIRE(assigned == list);
+        REQUIRE(moved.empty());
+    }
+
+    SECTION("swap") {
+        UnrolledLinkedList<std::string, 4> other;
+        other.push("a");
+        list.swap(other);
+        REQUIRE(list.size() == 1);
+        REQUIRE(other.size() == 6);
+        REQUIRE(other[5] == "5");
+    }
+}
+
+TEST_CASE("UnrolledLinkedList insert/erase functions") {
+    SECTION("insertBefore") {
+        UnrolledLinkedList<int, 4> list;
+        list.insertBefore(0, 1);
+        list.insertBefore(0, 0);
+        list.insertBefore(2, 3);
+        list.insertBefore(2, 2);
+        list.insertBefore(2, 5);
+        REQUIRE(list.size() == 5);
+        REQUIRE(list[0] == 0);
+        REQUIRE(list[1] == 1);
+        REQUIRE(list[2] == 5);
+        REQUIRE(list[3] == 2);
+        REQUIRE(list[4] == 3);
+        REQUIRE_THROWS_AS(list.insertBefore(6, 0), IllegalIndexException);
+    }
+
+    SECTION("insertAfter") {
+        UnrolledLinkedList<int, 4> list;
+        REQUIRE_THROWS_AS(list.insertAfter(0, 0), IllegalIndexException);
+        list.push(0);
+        list.insertAfter(0, 2);
+        list.insertAfter(0, 1);
+        REQUIRE(list.size() == 3);
+        REQUIRE(list[1] == 1);
+        REQUIRE(list[2] == 2);
+    }
+
+    SECTION("insert an element of the list into a full block") {
+        UnrolledLinkedList<std::string, 2> list;
+        list.push("a");
+        list.push("b");
+        list.insertAfter(0, list[1]);
+        list.push(list[0]);
+        REQUIRE(list.size() == 4);
+        REQUIRE(list[1] == "b");
+        REQUIRE(list[3] == "a");
+    }
+
+    SECTION("insert an element of the list into a block with room left") {
+        UnrolledLinkedList<std::string, 8> list;
+        list.push("a");
+        list.push("b");
+        list.insertBefore(0, list[0]);
+        list.insertBefore(1, list[2]);
+        REQUIRE(list.size() == 4);
+        REQUIRE(list[0] == "a");
+        REQUIRE(list[1] == "b");
+        REQUIRE(list[2] == "a");
+        REQUIRE(list[3] == "b");
+    }
+
+    SECTION("erase and pop") {
+        UnrolledLinkedList<int, 4> list;
+        for (int i = 0; i < 10; i++) list.push(i);
+        list.erase(0);
+        list.erase(4);
+        list.erase(7);
+        list.pop();
+        REQUIRE(list.size() == 6);
+        REQUIRE(list[0] == 1);
+        REQUIRE(list[4] == 6);
+        REQUIRE(list[5] == 7);
+        REQUIRE_THROWS_AS(list.erase(6), IllegalIndexException);
+
+        while (!list.empty()) list.erase(0);
+        list.push(1);
+        REQUIRE(list.size() == 1);
+        REQUIRE(list[0] == 1);
+    }
+
+    SECTION("random operations behave like a vector") {
+        UnrolledLinkedList<int, 8> list;
+        Vector<int> expected;
+        std::srand(42);
+        for (int i = 0; i < 5000; i++) {
+            int operation = std::rand() % 4;
+            if (operation == 0 || expected.size() < 2) {
+                list.push(i);
+                expected.push(i);
+            } else if (operation == 1) {
+                size_t at = std::rand() % expected.size();
+                list.insertBefore(at, i);
+                expected.insert(at, i);
+            } else if (operation == 2) {
+                size_t at = std::rand() % expected.size();
+                list.erase(at);
+                expected.erase(at);
+            } else {
+                list.pop();
+                expected.pop();
+            }
+        }
+
+        REQUIRE(list.size() == expected.size());
+        size_t i = 0;
+        bool same = true;
+        for (int value: list) same = same && value == expected[i++];
+        REQUIRE(same);
+    }
+}
+
+TEST_CASE("UnrolledLinkedList Iterators") {
+    UnrolledLinkedList<int, 2> list;
+    for (int i = 1; i <= 5; i++) list.push(i);
+
+    int result = 0;
+    for(int& value: list) {
+        result += value;
+    }
+
+    REQUIRE(result == 15);
+}
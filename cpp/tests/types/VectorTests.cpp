@@ -1,6 +1,15 @@
 #include "catch.hpp"
+#include "types/Array.hpp"
 #include "types/Vector.hpp"
 
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
 TEST_CASE("Vector constructors and copy/move semantics") {
     SECTION("Vector::Vector()") {
         Vector<int> vect;
@@ -56,6 +65,37 @@ TEST_CASE("Vector constructors and copy/move semantics") {
         REQUIRE_THROWS_AS(copy[0], IllegalIndexException);
     }
 
+    SECTION("Vector::Vector(Vector&&) hands over the buffer") {
+        Vector<int> vect = {0, 1, 2};
+        const int* buffer = vect.begin();
+        Vector<int> moved(std::move(vect));
+
+        REQUIRE(moved.begin() == buffer);
+        REQUIRE(moved == Vector<int>({0, 1, 2}));
+        REQUIRE(vect.capacity() == 0);
+    }
+
+    SECTION("operator=(Vector&&)") {
+        Vector<int> vect = {0, 1, 2};
+        const int* buffer = vect.begin();
+        Vector<int> moved = {5, 6};
+        moved = std::move(vect);
+
+        REQUIRE(moved.begin() == buffer);
+        REQUIRE(moved == Vector<int>({0, 1, 2}));
+        REQUIRE(vect.empty());
+        REQUIRE(vect.capacity() == 0);
+    }
+
+    SECTION("Vector::swap(Vector&)") {
+        Vector<int> vect1 = {0, 1, 2};
+        Vector<int> vect2 = {3};
+        vect1.swap(vect2);
+
+        REQUIRE(vect1 == Vector<int>({3}));
+        REQUIRE(vect2 == Vector<int>({0, 1, 2}));
+    }
+
     SECTION("Vector::Vector(std::initializer_list)") {
         Vector<int> vect = {0, 1, 2};
 
@@ -219,4 +259,442 @@ TEST_CASE("Vector Iterators") {
     }
 
     REQUIRE(result == 3);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Vector bounds check policies") {
+    SECTION("at() always checks bounds") {
+        Vector<int, UncheckedBounds> vect(2, 1);
+        const Vector<int, UncheckedBounds> cvect(2, 1);
+
+        REQUIRE(vect.at(1) == 1);
+        REQUIRE(cvect.at(1) == 1);
+        REQUIRE_THROWS_AS(vect.at(2), IllegalIndexException);
+        REQUIRE_THROWS_AS(cvect.at(2), IllegalIndexException);
+    }
+
+    SECTION("unchecked operator[]") {
+        Vector<int, UncheckedBounds> vect(3, 0);
+        for (size_t i = 0; i < vect.size(); i++) vect[i] = (int)i;
+
+        REQUIRE(vect[0] == 0);
+        REQUIRE(vect[2] == 2);
+        REQUIRE(vect == Vector<int, UncheckedBounds>({0, 1, 2}));
+    }
+
+    SECTION("erase/insert keep validating their index") {
+        Vector<int, UncheckedBounds> vect = {0, 1, 2};
+        REQUIRE_THROWS_AS(vect.erase(3), IllegalIndexException);
+        REQUIRE_THROWS_AS(vect.insert(3, 0), IllegalIndexException);
+    }
+}
+
+namespace {
+    struct Tracked {
+        static int constructions;
+        static int destructions;
+        std::string payload;
+
+        Tracked(std::string payload = "") : payload(std::move(payload)) { constructions++; }
+        Tracked(const Tracked& other) : payload(other.payload) { constructions++; }
+        Tracked(Tracked&& other) noexcept : payload(std::move(other.payload)) { constructions++; }
+        ~Tracked() { destructions++; }
+        Tracked& operator=(const Tracked&) = default;
+        Tracked& operator=(Tracked&&) = default;
+        bool operator!=(const Tracked& other) const { return payload != other.payload; }
+    };
+
+    int Tracked::constructions = 0;
+    int Tracked::destructions = 0;
+}
+
+TEST_CASE("Vector storage of non trivial elements") {
+    Tracked::constructions = 0;
+    Tracked::destructions = 0;
+
+    SECTION("reserve does not construct elements") {
+        Vector<Tracked> vect;
+        vect.reserve(64);
+        REQUIRE(vect.capacity() == 64);
+        REQUIRE(Tracked::constructions == 0);
+    }
+
+    SECTION("growth keeps elements intact") {
+        {
+            Vector<Tracked> vect;
+            for (int i = 0; i < 100; i++) vect.push(Tracked(std::to_string(i)));
+            REQUIRE(vect.size() == 100);
+            for (int i = 0; i < 100; i++) REQUIRE(vect[i].payload == std::to_string(i));
+
+            vect.push(vect.first());
+            REQUIRE(vect.last().payload == "0");
+        }
+        REQUIRE(Tracked::constructions == Tracked::destructions);
+    }
+
+    SECTION("erase/pop/clear destroy elements") {
+        {
+            Vector<Tracked> vect(4, Tracked("a"));
+            vect.erase(1);
+            vect.pop();
+            REQUIRE(vect.size() == 2);
+            vect.clear();
+            REQUIRE(vect.empty());
+            REQUIRE(Tracked::constructions == Tracked::destructions);
+        }
+        REQUIRE(Tracked::constructions == Tracked::destructions);
+    }
+
+    SECTION("insert shifts non trivial elements") {
+        Vector<std::string> vect = {"a", "b", "c"};
+        vect.insert(1, "x");
+        REQUIRE(vect == Vector<std::string>({"a", "x", "b", "c"}));
+        vect.insert(0, vect[2]);
+        REQUIRE(vect == Vector<std::string>({"b", "a", "x", "b", "c"}));
+    }
+
+    SECTION("resize grows and shrinks") {
+        Vector<std::string> vect = {"a", "b", "c", "d"};
+        vect.resize(1);
+        REQUIRE(vect == Vector<std::string>({"a"}));
+        vect.resize(3, "z");
+        REQUIRE(vect == Vector<std::string>({"a", "z", "z"}));
+    }
+}
+
+namespace {
+    // Equal whenever the last digits are, which a bytewise comparison would get wrong
+    struct LastDigit {
+        int value;
+        bool operator!=(const LastDigit& other) const { return value % 10 != other.value % 10; }
+    };
+}
+
+TEST_CASE("Vector bulk copies, fills and comparisons") {
+    SECTION("copies of trivially copyable elements") {
+        Vector<int> vect;
+        for (int i = 0; i < 1000; i++) vect.push(i);
+        Vector<int> copy(vect);
+        REQUIRE(copy == vect);
+        copy[999] = -1;
+        REQUIRE(copy != vect);
+
+        copy = vect;
+        REQUIRE(copy == vect);
+        Vector<int> empty;
+        copy = empty;
+        REQUIRE(copy.empty());
+        REQUIRE(Vector<int>(empty).empty());
+        REQUIRE(Vector<int>({1, 2, 3})[2] == 3);
+    }
+
+    SECTION("fills with uniform and non uniform byte patterns") {
+        Vector<int> vect(100, 5);
+        vect.fill(0);
+        REQUIRE(vect == Vector<int>(100, 0));
+        vect.fill(-1);
+        REQUIRE(vect == Vector<int>(100, -1));
+        vect.fill(0x01020304);
+        REQUIRE(vect[99] == 0x01020304);
+
+        Vector<double> doubles(10, 1.0);
+        doubles.fill(0.5);
+        REQUIRE(doubles[9] == 0.5);
+    }
+
+    SECTION("comparisons keep the semantics of the elements") {
+        // Equal values with distinct bytes
+        REQUIRE(Vector<double>({0.0}) == Vector<double>({-0.0}));
+        double nan = std::numeric_limits<double>::quiet_NaN();
+        REQUIRE(Vector<double>({nan}) != Vector<double>({nan}));
+        REQUIRE(Vector<LastDigit>({{1}, {2}}) == Vector<LastDigit>({{11}, {32}}));
+        REQUIRE(Vector<std::string>({"a"}) != Vector<std::string>({"b"}));
+    }
+}
+
+TEST_CASE("Vector arithmetic") {
+    Vector<float> a = {1, 2, 3, 4, 5};
+    Vector<float> b = {5, 4, 3, 2, 1};
+    Vector<float> c = {2, 2, 2, 2, 2};
+
+    SECTION("reductions and searches") {
+        REQUIRE(a.sum() == 15);
+        REQUIRE(a.min() == 1);
+        REQUIRE(b.max() == 5);
+        REQUIRE(a.dot(b) == 35);
+        REQUIRE(a.find(3) == a.begin() + 2);
+        REQUIRE(a.find(6) == a.end());
+        REQUIRE(c.occurrences(2) == 5);
+
+        a.axpy(2, c);
+        REQUIRE(a == Vector<float>({5, 6, 7, 8, 9}));
+
+        Vector<float> empty;
+        REQUIRE(empty.sum() == 0);
+        REQUIRE_THROWS_AS(empty.min(), IllegalAccessException);
+        REQUIRE_THROWS_AS(a.dot(empty), IllegalAccessException);
+        REQUIRE_THROWS_AS(a.axpy(1, empty), IllegalAccessException);
+    }
+
+    SECTION("element-wise expressions") {
+        Vector<float> result = a + b * c;
+        REQUIRE(result == Vector<float>({11, 10, 9, 8, 7}));
+
+        result = (a - b) / c;
+        REQUIRE(result == Vector<float>({-2, -1, 0, 1, 2}));
+
+        result = 2 * a + 1;
+        REQUIRE(result == Vector<float>({3, 5, 7, 9, 11}));
+
+        // Reading the destination itself
+        result = result - a;
+        REQUIRE(result == Vector<float>({2, 3, 4, 5, 6}));
+
+        // Assigning an expression of another size replaces the contents
+        Vector<float> other = {1};
+        other = a * a;
+        REQUIRE(other == Vector<float>({1, 4, 9, 16, 25}));
+
+        Vector<float> shorter = {1, 2};
+        REQUIRE_THROWS_AS(a + shorter, IllegalAccessException);
+    }
+
+    SECTION("long integer expressions") {
+        Vector<int> x, y;
+        for (int i = 0; i < 10000; i++) {
+            x.push(i);
+            y.push(3 * i);
+        }
+        Vector<int> z = x * 3 - y + x;
+        REQUIRE(z == x);
+        REQUIRE(z.sum() == 9999 * 10000 / 2);
+    }
+}
+
+namespace {
+    template <typename Allocation>
+    void checkAllocation(size_t size) {
+        Vector<int64_t, DefaultBoundsCheck, Allocation> numbers;
+        Vector<std::string, DefaultBoundsCheck, Allocation> strings;
+        bool aligned = true;
+        for (size_t i = 0; i < size; i++) {
+            numbers.push((int64_t)i);
+            if (i % 1000 == 0) strings.push(std::to_string(i));
+            aligned = aligned && reinterpret_cast<uintptr_t>(numbers.begin()) % Allocation::alignment == 0;
+        }
+        REQUIRE(aligned);
+        bool intact = true;
+        for (size_t i = 0; i < size; i++) intact = intact && numbers[i] == (int64_t)i;
+        REQUIRE(intact);
+        for (size_t i = 0; i < strings.size(); i++) REQUIRE(strings[i] == std::to_string(i * 1000));
+
+        Vector<int64_t, DefaultBoundsCheck, Allocation> copy(numbers);
+        REQUIRE(copy == numbers);
+        numbers.deallocate();
+        REQUIRE(numbers.capacity() == 0);
+        numbers.push(1);
+        REQUIRE(numbers[0] == 1);
+    }
+}
+
+TEST_CASE("Vector allocation policies") {
+    SECTION("default") { checkAllocation<DefaultAllocation>(5000); }
+    SECTION("cache line aligned") { checkAllocation<AlignedAllocation<>>(5000); }
+    SECTION("page aligned") { checkAllocation<AlignedAllocation<4096>>(5000); }
+
+    SECTION("over-aligned elements") {
+        struct alignas(64) Line { char bytes[64]; };
+        Vector<Line, DefaultBoundsCheck, AlignedAllocation<64>> lines(10, Line{});
+        REQUIRE(reinterpret_cast<uintptr_t>(lines.begin()) % 64 == 0);
+    }
+
+    // 2^20 64 bits integers cross the huge page threshold, going from malloc to mmap and then mremap
+    SECTION("huge pages") { checkAllocation<HugePageAllocation>(size_t(1) << 20); }
+    SECTION("reserved huge pages") { checkAllocation<ReservedHugePageAllocation>(size_t(1) << 20); }
+
+    SECTION("huge page blocks start on a huge page boundary") {
+        Vector<int64_t, DefaultBoundsCheck, HugePageAllocation> numbers;
+        bool aligned = true;
+        for (size_t i = 0; i < (size_t(3) << 20); i++) {
+            numbers.push((int64_t)i);
+            if (numbers.capacity() * sizeof(int64_t) >= HugePageAllocation::HugePageSize) {
+                aligned = aligned && reinterpret_cast<uintptr_t>(numbers.begin()) % HugePageAllocation::HugePageSize == 0;
+            }
+        }
+        REQUIRE(aligned);
+        REQUIRE(numbers.last() == (int64_t)(size_t(3) << 20) - 1);
+    }
+}
+
+namespace {
+    template <typename Growth, typename T = int>
+    std::vector<size_t> capacities(size_t pushes) {
+        Vector<T, DefaultBoundsCheck, DefaultAllocation, Growth> vect;
+        std::vector<size_t> result = {vect.capacity()};
+        for (size_t i = 0; i < pushes; i++) {
+            vect.push(T());
+            if (vect.capacity() != result.back()) result.push_back(vect.capacity());
+        }
+        return result;
+    }
+}
+
+TEST_CASE("Vector growth policies") {
+    SECTION("doubling") {
+        REQUIRE(capacities<DoublingGrowth>(20) == std::vector<size_t>({0, 1, 2, 4, 8, 16, 32}));
+    }
+
+    SECTION("one and a half") {
+        REQUIRE(capacities<OneAndHalfGrowth>(20) == std::vector<size_t>({0, 1, 2, 3, 4, 6, 9, 13, 19, 28}));
+    }
+
+    SECTION("page rounded") {
+        // Rounded once past 4096 bytes: 1024 ints, then 2048...
+        REQUIRE(capacities<PageRoundedGrowth<OneAndHalfGrowth>>(2000).back() == 2048);
+        REQUIRE(capacities<PageRoundedGrowth<OneAndHalfGrowth>>(3000).back() == 3072);
+        REQUIRE(capacities<PageRoundedGrowth<>, std::array<char, 2500>>(3) == std::vector<size_t>({0, 1, 3}));
+
+        Vector<int, DefaultBoundsCheck, DefaultAllocation, PageRoundedGrowth<>> vect;
+        vect.reserve(1500);
+        REQUIRE(vect.capacity() == 2048);
+        vect.reserveExact(2500);
+        REQUIRE(vect.capacity() == 2500);
+    }
+
+    SECTION("chunked") {
+        // Doubles up to 64 bytes, then grows by 64 bytes
+        REQUIRE(capacities<ChunkedGrowth<64>>(40) == std::vector<size_t>({0, 1, 2, 4, 8, 16, 32, 48}));
+        REQUIRE(capacities<ChunkedGrowth<64>, std::array<char, 100>>(3) == std::vector<size_t>({0, 1, 2, 3}));
+    }
+
+    SECTION("reserve grows at least to the requested size") {
+        Vector<int, DefaultBoundsCheck, DefaultAllocation, OneAndHalfGrowth> vect;
+        vect.reserve(10);
+        REQUIRE(vect.capacity() == 10);
+        vect.reserve(5);
+        REQUIRE(vect.capacity() == 10);
+    }
+
+    SECTION("shrinkToFit") {
+        Vector<std::string> strings;
+        for (int i = 0; i < 5; i++) strings.push(std::to_string(i));
+        REQUIRE(strings.capacity() == 8);
+        strings.shrinkToFit();
+        REQUIRE(strings.capacity() == 5);
+        REQUIRE(strings == Vector<std::string>({"0", "1", "2", "3", "4"}));
+        strings.push("5");
+        REQUIRE(strings.capacity() == 10);
+
+        strings.clear();
+        strings.shrinkToFit();
+        REQUIRE(strings.capacity() == 0);
+        REQUIRE(strings.begin() == nullptr);
+
+        Vector<int, DefaultBoundsCheck, HugePageAllocation> numbers(1000000, 7);
+        numbers.reserveExact(2000000);
+        numbers.shrinkToFit();
+        REQUIRE(numbers.capacity() == 1000000);
+        REQUIRE(numbers.occurrences(7) == 1000000);
+    }
+}
+
+TEST_CASE("Vector range insertions and erasures") {
+    SECTION("insert a range of trivial elements") {
+        Vector<int> vect = {1, 2, 3};
+        int values[] = {7, 8};
+        vect.insert(0, values, values + 2);
+        REQUIRE(vect == Vector<int>({7, 8, 1, 2, 3}));
+        vect.insert(2, {5});
+        REQUIRE(vect == Vector<int>({7, 8, 5, 1, 2, 3}));
+        vect.insert(6, values, values + 2);
+        REQUIRE(vect == Vector<int>({7, 8, 5, 1, 2, 3, 7, 8}));
+        vect.insert(3, values, values);
+        REQUIRE(vect.size() == 8);
+        REQUIRE_THROWS_AS(vect.insert(9, values, values + 2), IllegalIndexException);
+    }
+
+    SECTION("insert a range of non trivial elements") {
+        Vector<std::string> vect = {"a", "b", "c"};
+        std::vector<std::string> values = {"x", "y", "z", "w"};
+        vect.insert(1, values.begin(), values.end());
+        REQUIRE(vect == Vector<std::string>({"a", "x", "y", "z", "w", "b", "c"}));
+        vect.insert(7, {"e"});
+        REQUIRE(vect == Vector<std::string>({"a", "x", "y", "z", "w", "b", "c", "e"}));
+    }
+
+    SECTION("insert part of the vector itself") {
+        Vector<int> numbers = {1, 2, 3};
+        numbers.insert(1, numbers.begin(), numbers.end());
+        REQUIRE(numbers == Vector<int>({1, 1, 2, 3, 2, 3}));
+
+        Vector<std::string> strings = {"a", "b"};
+        strings.insert(0, strings.begin(), strings.end());
+        REQUIRE(strings == Vector<std::string>({"a", "b", "a", "b"}));
+        strings.append(strings);
+        REQUIRE(strings.size() == 8);
+        REQUIRE(strings[7] == "b");
+    }
+
+    SECTION("insert from single pass iterators") {
+        std::istringstream input("4 5 6");
+        Vector<int> vect = {1, 2};
+        vect.insert(1, std::istream_iterator<int>(input), std::istream_iterator<int>());
+        REQUIRE(vect == Vector<int>({1, 4, 5, 6, 2}));
+    }
+
+    SECTION("emplace") {
+        Vector<std::string> vect;
+        REQUIRE(vect.emplace(0, 3, 'a') == "aaa");
+        vect.emplace(0, "b");
+        vect.emplace(1, vect[0]);
+        REQUIRE(vect == Vector<std::string>({"b", "b", "aaa"}));
+        REQUIRE_THROWS_AS(vect.emplace(4, "c"), IllegalIndexException);
+    }
+
+    SECTION("append") {
+        Vector<int> vect;
+        vect.append(std::vector<int>({1, 2}));
+        vect.append({3});
+        Array<int, 2> array(4);
+        vect.append(array);
+        REQUIRE(vect == Vector<int>({1, 2, 3, 4, 4}));
+    }
+
+    SECTION("erase a range") {
+        Vector<int> vect = {0, 1, 2, 3, 4, 5};
+        vect.erase(1, 3);
+        REQUIRE(vect == Vector<int>({0, 3, 4, 5}));
+        vect.erase(2, 2);
+        REQUIRE(vect.size() == 4);
+        vect.erase(2, 4);
+        REQUIRE(vect == Vector<int>({0, 3}));
+        REQUIRE_THROWS_AS(vect.erase(1, 3), IllegalIndexException);
+        REQUIRE_THROWS_AS(vect.erase(2, 1), IllegalIndexException);
+    }
+
+    SECTION("non trivial elements are all destroyed") {
+        Tracked::constructions = 0;
+        Tracked::destructions = 0;
+        {
+            Vector<Tracked> vect;
+            for (int i = 0; i < 10; i++) vect.push(Tracked(std::to_string(i)));
+            Vector<Tracked> others(3, Tracked("x"));
+            vect.insert(4, others.begin(), others.end());
+            vect.emplace(2, "y");
+            REQUIRE(vect[2].payload == "y");
+            REQUIRE(vect[5].payload == "x");
+            REQUIRE(vect[8].payload == "4");
+            vect.erase(3, 9);
+            REQUIRE(vect.size() == 8);
+            REQUIRE(vect[3].payload == "5");
+            vect.resize(2);
+            vect.resize(4, vect[0]);
+            REQUIRE(vect[3].payload == "0");
+
+            int alive = Tracked::constructions - Tracked::destructions;
+            REQUIRE(alive == 4 + 3);
+            vect.clear();
+            REQUIRE(Tracked::constructions - Tracked::destructions == 3);
+        }
+        REQUIRE(Tracked::constructions == Tracked::destructions);
+    }
+}